@@ -0,0 +1,57 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2021)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "utils.h"
+
+#include "higra/algo/tree_monotonic_regression.hpp"
+#include "xtensor/generators/xrandom.hpp"
+
+using namespace xt;
+using namespace hg;
+
+std::size_t min_tree_size_regression = 16;
+std::size_t max_tree_size_regression = 22;
+
+static void BM_tree_monotonic_regression(benchmark::State &state, const std::string &mode) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::size_t size = state.range(0);
+        xt::random::seed(42);
+        auto t = get_complete_binary_tree(size);
+        array_1d<double> altitudes = xt::random::rand<double>({num_vertices(t)});
+        array_1d<double> weights = xt::random::rand<double>({num_vertices(t)}) + 1;
+        state.ResumeTiming();
+
+        auto res = (mode == "least_square") ?
+                   tree_monotonic_regression(t, altitudes, weights, mode) :
+                   tree_monotonic_regression(t, altitudes, mode);
+        benchmark::DoNotOptimize(res(root(t)));
+    }
+}
+
+static void BM_tree_monotonic_regression_max(benchmark::State &state) {
+    BM_tree_monotonic_regression(state, "max");
+}
+
+BENCHMARK(BM_tree_monotonic_regression_max)->Range(1 << min_tree_size_regression, 1 << max_tree_size_regression);
+
+static void BM_tree_monotonic_regression_min(benchmark::State &state) {
+    BM_tree_monotonic_regression(state, "min");
+}
+
+BENCHMARK(BM_tree_monotonic_regression_min)->Range(1 << min_tree_size_regression, 1 << max_tree_size_regression);
+
+static void BM_tree_monotonic_regression_least_square(benchmark::State &state) {
+    BM_tree_monotonic_regression(state, "least_square");
+}
+
+BENCHMARK(BM_tree_monotonic_regression_least_square)->Range(1 << min_tree_size_regression,
+                                                             1 << max_tree_size_regression);
@@ -77,6 +77,30 @@ def __labelisation_leaves(self, tree, leaf_graph, handle_rag=True):
     return labels
 
 
+@hg.extend_class(hg.HorizontalCutsLabelisations, method_name="labelisation_leaves")
+@hg.argument_helper(("tree", hg.CptHierarchy))
+def __labelisation_leaves_cuts(self, i, tree, leaf_graph, handle_rag=True):
+    """
+    Labelize tree leaves according to the i-th stored horizontal cut.
+    Two leaves are in the same region (ie. have the same label) if their lowest common ancestor is a subset or equal to
+    one the node of the cut.
+
+    :param i: index of the cut in :func:`~higra.HorizontalCutsLabelisations.cut_indices`
+    :param tree: input tree (Concept :class:`~higra.CptHierarchy`)
+    :param leaf_graph: graph on the tree leaves (deduced from :class:`~higra.CptHierarchy`)
+    :param handle_rag: if `True` and if `leaf_graph` is a region adjacency graph then the labels are given for the original graph (the pre-graph of the region adjacency graph).
+    :return: a 1d array
+    """
+    labels = self._labelisation_leaves(i)
+
+    if hg.CptRegionAdjacencyGraph.validate(leaf_graph) and handle_rag:
+        labels = hg.rag_back_project_vertex_weights(leaf_graph, labels)
+    else:
+        labels = hg.delinearize_vertex_weights(labels, leaf_graph)
+
+    return labels
+
+
 @hg.extend_class(hg.HorizontalCutExplorer, method_name="__new__")
 def __make_HorizontalCutExplorer(cls, tree, altitudes):
     """
@@ -65,6 +65,61 @@ namespace py_horizontal_cuts {
                 );
     }
 
+    template<typename tree_t>
+    void def_horizontal_cuts_labelisations(pybind11::module &m) {
+        using class_t = hg::horizontal_cuts_labelisations;
+        auto c = py::class_<class_t>(m, "HorizontalCutsLabelisations",
+                                     R"""(Labelisations of the leaves of a hierarchy for several horizontal cuts in a compact label remap
+representation.
+
+As horizontal cuts are nested, the regions of the finest cut (called base regions) are included in the
+regions of every other cut. The labelisation of the tree leaves for the i-th cut is thus given by
+``label_maps()[i, leaf_labels()]``.)""");
+        c.def("num_cuts", &class_t::num_cuts, "Number of stored cuts.");
+        c.def("cut_indices",
+              [](const class_t &c) -> const array_1d<index_t> & { return c.cut_indices; },
+              "Indices of the stored cuts in the horizontal cut explorer.");
+        c.def("leaf_labels",
+              [](const class_t &c) -> const array_1d<index_t> & { return c.leaf_labels; },
+              "Index of the base region (region of the finest stored cut) of each tree leaf.");
+        c.def("label_maps",
+              [](const class_t &c) -> const array_2d<index_t> & { return c.label_maps; },
+              "2d array such that the element (i, j) is the label of the j-th base region in the i-th stored cut.");
+        c.def("_labelisation_leaves",
+              [](const class_t &c, index_t i) {
+                  hg_assert(i >= 0, "Cut index cannot be negative.");
+                  hg_assert(i < (index_t) c.num_cuts(), "Cut index out of bounds.");
+                  return c.labelisation_leaves(i);
+              },
+              "Labelisation of the tree leaves for the i-th stored cut.",
+              py::arg("i"));
+    }
+
+    template<typename c_t>
+    void def_horizontal_cut_incremental_labelisation(pybind11::module &m) {
+        using class_t = hg::horizontal_cut_incremental_labelisation<c_t>;
+        auto c = py::class_<class_t>(m, "HorizontalCutIncrementalLabelisation",
+                                     R"""(Labelisation of the leaves of a hierarchy that can be updated incrementally from one horizontal cut
+to the next (finer) or previous (coarser) cut: only the leaves of the regions that are split or merged between the
+two cuts are relabeled.)""");
+        c.def("cut_index", &class_t::cut_index, "Index of the current cut.");
+        c.def("num_regions", &class_t::num_regions, "Number of regions in the current cut.");
+        c.def("altitude", &class_t::altitude, "Altitude of the current cut.");
+        c.def("labelisation_leaves",
+              [](const class_t &c) { return c.labelisation_leaves(); },
+              "Labelisation of the tree leaves for the current cut (labels are the indices of the cut nodes).");
+        c.def("next_cut", &class_t::next_cut,
+              "Move to the next (finer) cut. Returns ``False`` if the current cut is already the finest one, "
+              "``True`` otherwise.");
+        c.def("previous_cut", &class_t::previous_cut,
+              "Move to the previous (coarser) cut. Returns ``False`` if the current cut is already the coarsest one, "
+              "``True`` otherwise.");
+        c.def("set_cut",
+              &class_t::set_cut,
+              "Move to the given cut by successive merges or splits.",
+              py::arg("cut_index"));
+    }
+
     template<typename c_t>
     struct def_horizontal_cut_explorer_ctr {
         template<typename type, typename C>
@@ -137,12 +192,29 @@ If :attr:`at_least` is ``False``, the the largest horizontal cut having at most
 regions is returned.)""",
               py::arg("num_regions"),
               py::arg("at_least") = true);
+        c.def("incremental_labelisation",
+              &class_t::incremental_labelisation,
+              R"""(Creates an object maintaining the labelisation of the tree leaves for a current horizontal cut, starting at
+the cut of given index. Moving to the next or previous cut only relabels the leaves of the regions which are split or
+merged. The returned object keeps the explorer alive.)""",
+              py::arg("cut_index") = 0,
+              py::keep_alive<0, 1>());
+        c.def("labelisations_from_indices",
+              [](const class_t &c, const xt::pytensor<index_t, 1> &cut_indices) {
+                  return c.labelisations_from_indices(cut_indices);
+              },
+              R"""(Labelisations of the tree leaves for the horizontal cuts of given indices, in the compact label remap
+representation :class:`~higra.HorizontalCutsLabelisations`. This operation runs in :math:`\mathcal{O}(n + m*k)`, with
+:math:`m` the number of requested cuts and :math:`k` the number of regions in the finest requested cut.)""",
+              py::arg("cut_indices"));
     }
 
     void py_init_horizontal_cuts(pybind11::module &m) {
         //xt::import_numpy();
 
         def_horizontal_cut_nodes<hg::tree>(m);
+        def_horizontal_cuts_labelisations<hg::tree>(m);
         def_horizontal_cut_explorer<hg::tree>(m);
+        def_horizontal_cut_incremental_labelisation<hg::horizontal_cut_explorer<hg::tree, double>>(m);
     }
 }
@@ -102,3 +102,118 @@ def assess_fragmentation_horizontal_cut(tree,
         return hg.cpp._assess_fragmentation_horizontal_cut(tree, altitudes, ground_truth, measure,
                                                            max_regions=int(max_regions),
                                                            vertex_map=vertex_map)
+
+
+def __normalize_ground_truths(ground_truths):
+    ground_truths = np.asarray(ground_truths)
+    if ground_truths.ndim == 1:
+        ground_truths = ground_truths.reshape((1, -1))
+    elif ground_truths.ndim > 2:
+        ground_truths = ground_truths.reshape((ground_truths.shape[0], -1))
+    return ground_truths
+
+
+@hg.argument_helper(hg.CptHierarchy, ("leaf_graph", hg.CptRegionAdjacencyGraph))
+def make_assesser_fragmentation_optimal_cut_multiple_ground_truths(tree,
+                                                                   ground_truths,
+                                                                   measure,
+                                                                   max_regions=200,
+                                                                   vertex_map=None):
+    """
+    Creates an assesser for hierarchy optimal cuts w.r.t. several ground-truth partitions of the base graph vertices
+    (for example the different human annotations of an image) and the given optimal cut measure
+    (see :class:`~higra.OptimalCutMeasure`).
+    The algorithms will explore optimal cuts containing at most max_regions regions.
+
+    The tree preprocessing is shared between the different ground-truths which are evaluated in parallel.
+    The assesser gives access to the results for each ground-truth and to the aggregated results: the aggregated
+    measure is the mean of the measures obtained for each ground-truth.
+
+    The base graph of the hierarchy is:
+
+        * the leaf graph of the hierarchy if it is not a region adjacency graph
+        * the original graph of the leaf graph of the hierarchy if it is a region adjacency graph
+
+    :param tree: input hierarchy (Concept :class:`~higra.CptHierarchy`)
+    :param ground_truths: list of labelisations of base graph vertices (or array whose first dimension indexes the different ground-truths)
+    :param measure: evaluation measure to use (see enumeration :class:`~higra.OptimalCutMeasure`)
+    :param max_regions: maximum number of regions in the cuts
+    :param vertex_map: optional, vertex mapping if the hierarchy is build on a region adjacency graph (deduced from :class:`~higra.CptRegionAdjacencyGraph` on the leaf graph of `tree`)
+    :return: an object of type :class:`~higra.AssesserFragmentationOptimalCutMultipleGroundTruths`
+    """
+    ground_truths = __normalize_ground_truths(ground_truths)
+    if vertex_map is None:
+        return hg.AssesserFragmentationOptimalCutMultipleGroundTruths(tree, ground_truths, measure,
+                                                                      max_regions=int(max_regions))
+    else:
+        vertex_map = hg.cast_to_dtype(vertex_map, np.int64)
+        return hg.AssesserFragmentationOptimalCutMultipleGroundTruths(tree, ground_truths, measure,
+                                                                      max_regions=int(max_regions),
+                                                                      vertex_map=vertex_map)
+
+
+@hg.argument_helper(hg.CptHierarchy, ("leaf_graph", hg.CptRegionAdjacencyGraph))
+def assess_fragmentation_optimal_cut_multiple_ground_truths(tree,
+                                                            ground_truths,
+                                                            measure,
+                                                            max_regions=200,
+                                                            vertex_map=None):
+    """
+    Fragmentation curves of the optimal cuts in a hierarchy w.r.t. several ground-truths and a given measure.
+
+    The aggregated fragmentation curve gives, for each number of regions k, the mean score over all the ground-truths
+    of the cut with k regions maximizing this mean score.
+
+    See :func:`~higra.make_assesser_fragmentation_optimal_cut_multiple_ground_truths`.
+
+    :param tree: input hierarchy (Concept :class:`~higra.CptHierarchy`)
+    :param ground_truths: list of labelisations of base graph vertices (or array whose first dimension indexes the different ground-truths)
+    :param measure: evaluation measure to use (see enumeration :class:`~higra.OptimalCutMeasure`)
+    :param max_regions: maximum number of regions in the cuts
+    :param vertex_map: optional, vertex mapping if the hierarchy is build on a region adjacency graph (deduced from :class:`~higra.CptRegionAdjacencyGraph` on the leaf graph of `tree`)
+    :return: a list of :class:`~higra.FragmentationCurve` (one per ground-truth) and the aggregated :class:`~higra.FragmentationCurve`
+    """
+    assesser = make_assesser_fragmentation_optimal_cut_multiple_ground_truths(tree, ground_truths, measure,
+                                                                              max_regions, vertex_map)
+    return assesser.fragmentation_curves(), assesser.aggregated_fragmentation_curve()
+
+
+@hg.argument_helper(hg.CptHierarchy, ("leaf_graph", hg.CptRegionAdjacencyGraph))
+def assess_fragmentation_horizontal_cut_multiple_ground_truths(tree,
+                                                               altitudes,
+                                                               ground_truths,
+                                                               measure,
+                                                               max_regions=200,
+                                                               vertex_map=None):
+    """
+    Fragmentation curves of the horizontal cuts in a hierarchy w.r.t. several ground-truths and a given measure.
+
+    The horizontal cuts of the hierarchy are computed once and shared between the different ground-truths which are
+    evaluated in parallel. The aggregated fragmentation curve gives, for each horizontal cut, the mean of the scores
+    obtained for each ground-truth.
+
+    The base graph of the hierarchy is:
+
+        * the leaf graph of the hierarchy if it is not a region adjacency graph
+        * the original graph of the leaf graph of the hierarchy if it is a region adjacency graph
+
+    :param tree: input hierarchy (Concept :class:`~higra.CptHierarchy`)
+    :param altitudes: altitudes of the nodes of the input hierarchy
+    :param ground_truths: list of labelisations of base graph vertices (or array whose first dimension indexes the different ground-truths)
+    :param measure: evaluation measure to use (see enumeration :class:`~higra.PartitionMeasure`)
+    :param max_regions: maximum number of regions in the cuts
+    :param vertex_map: optional, vertex mapping if the hierarchy is build on a region adjacency graph (deduced from :class:`~higra.CptRegionAdjacencyGraph` on the leaf graph of `tree`)
+    :return: a list of :class:`~higra.FragmentationCurve` (one per ground-truth) and the aggregated :class:`~higra.FragmentationCurve`
+    """
+    ground_truths = hg.cast_to_dtype(__normalize_ground_truths(ground_truths), np.int64)
+
+    if vertex_map is None:
+        return hg.cpp._assess_fragmentation_horizontal_cut_multiple_ground_truths(tree, altitudes, ground_truths,
+                                                                                  measure,
+                                                                                  max_regions=int(max_regions))
+    else:
+        vertex_map = hg.cast_to_dtype(vertex_map, np.int64)
+        return hg.cpp._assess_fragmentation_horizontal_cut_multiple_ground_truths(tree, altitudes, ground_truths,
+                                                                                  measure,
+                                                                                  max_regions=int(max_regions),
+                                                                                  vertex_map=vertex_map)
@@ -37,6 +37,24 @@ namespace py_fragmentation_curve {
         }
     };
 
+    struct def_assesser_optimal_cut_multiple_ground_truths_ctr {
+        template<typename value_type, typename C>
+        static
+        void def(C &c, const char *doc) {
+            c.def(py::init<const hg::tree &,
+                          const xt::pyarray<value_type> &,
+                          optimal_cut_measure,
+                          const xt::pytensor<index_t, 1> &,
+                          hg::size_t>(),
+                  doc,
+                  py::arg("tree"),
+                  py::arg("ground_truths"),
+                  py::arg("optimal_cut_measure") = hg::optimal_cut_measure::BCE,
+                  py::arg("vertex_map") = xt::pytensor<index_t, 1>{},
+                  py::arg("max_regions") = 200);
+        }
+    };
+
     template<typename tree_t>
     struct def_assesse_horizontal_cut {
         template<typename value_type, typename C>
@@ -81,6 +99,48 @@ namespace py_fragmentation_curve {
         }
     };
 
+    template<typename tree_t>
+    struct def_assesse_horizontal_cut_multiple_ground_truths {
+        template<typename value_type, typename C>
+        static
+        void def(C &c, const char *doc) {
+            c.def("_assess_fragmentation_horizontal_cut_multiple_ground_truths",
+                  [](const tree_t &tree,
+                     const xt::pyarray<value_type> &altitudes,
+                     const xt::pyarray<index_t> &ground_truths,
+                     hg::partition_measure measure,
+                     const xt::pytensor<index_t, 1> &vertex_map,
+                     hg::size_t max_regions
+                  ) {
+                      switch (measure) {
+                          case partition_measure::DHamming:
+                              return hg::assess_fragmentation_horizontal_cut_multiple_ground_truths(
+                                      tree, altitudes, ground_truths, hg::scorer_partition_DHamming(), vertex_map,
+                                      max_regions);
+                          case partition_measure::DCovering:
+                              return hg::assess_fragmentation_horizontal_cut_multiple_ground_truths(
+                                      tree, altitudes, ground_truths, hg::scorer_partition_DCovering(), vertex_map,
+                                      max_regions);
+                          case partition_measure::BCE:
+                              return hg::assess_fragmentation_horizontal_cut_multiple_ground_truths(
+                                      tree, altitudes, ground_truths, hg::scorer_partition_BCE(), vertex_map,
+                                      max_regions);
+                          default:
+                              throw std::runtime_error(
+                                      "Partition measure is not known, see enumeration PartitionMeasure for legal values.");
+
+                      }
+                  },
+                  doc,
+                  py::arg("tree"),
+                  py::arg("altitudes"),
+                  py::arg("ground_truths"),
+                  py::arg("optimal_cut_measure"),
+                  py::arg("vertex_map") = xt::pytensor<index_t, 1>{},
+                  py::arg("max_regions") = 200);
+        }
+    };
+
     void py_init_fragmentation_curve(pybind11::module &m) {
         //xt::import_numpy();
 
@@ -139,5 +199,71 @@ namespace py_fragmentation_curve {
         add_type_overloads<def_assesse_horizontal_cut<hg::tree>, HG_TEMPLATE_NUMERIC_TYPES>
                 (m,
                  "Compute the fragmentation curve of the horizontal cuts in a hierarchy w.r.t. a given measure.");
+
+        using assesser_multi_t = assesser_fragmentation_optimal_cut_multiple_ground_truths;
+        auto cm = py::class_<assesser_multi_t>(m, "AssesserFragmentationOptimalCutMultipleGroundTruths");
+        add_type_overloads<def_assesser_optimal_cut_multiple_ground_truths_ctr, HG_TEMPLATE_INTEGRAL_TYPES>
+                (cm,
+                 "Create an assesser for hierarchy optimal cuts w.r.t. several ground-truth partitions of hierarchy "
+                 "leaves (one per line of the 2d array ground_truths) and the given optimal cut measure "
+                 "(see OptimalCutMeasure). The algorithms will explore optimal cuts containing at most "
+                 "max_regions regions.");
+
+        cm.def("num_ground_truths",
+               &assesser_multi_t::num_ground_truths,
+               "Number of ground truths evaluated by the assesser.");
+
+        cm.def("fragmentation_curve",
+               &assesser_multi_t::fragmentation_curve,
+               "Fragmentation curve of the given ground truth, i.e. for each number of region k between 1 and "
+               "max_regions, the score of the optimal cut with k regions.",
+               py::arg("ground_truth_index"));
+
+        cm.def("fragmentation_curves",
+               &assesser_multi_t::fragmentation_curves,
+               "List of the fragmentation curves of all the ground truths.");
+
+        cm.def("aggregated_fragmentation_curve",
+               &assesser_multi_t::aggregated_fragmentation_curve,
+               "Aggregated fragmentation curve, i.e. for each number of region k between 1 and max_regions, "
+               "the mean score over all the ground truths of the cut with k regions maximizing this mean score.");
+
+        cm.def("optimal_number_of_regions",
+               &assesser_multi_t::optimal_number_of_regions,
+               "Number of regions in the optimal cut for the given ground truth.",
+               py::arg("ground_truth_index"));
+
+        cm.def("aggregated_optimal_number_of_regions",
+               &assesser_multi_t::aggregated_optimal_number_of_regions,
+               "Number of regions in the optimal cut w.r.t. the aggregated measure.");
+
+        cm.def("optimal_score",
+               &assesser_multi_t::optimal_score,
+               "Score of the optimal cut for the given ground truth.",
+               py::arg("ground_truth_index"));
+
+        cm.def("aggregated_optimal_score",
+               &assesser_multi_t::aggregated_optimal_score,
+               "Score of the optimal cut w.r.t. the aggregated measure.");
+
+        cm.def("optimal_partition",
+               &assesser_multi_t::optimal_partition,
+               "Labelisation of the tree vertices that corresponds to the optimal cut with "
+               "the given number of regions for the given ground truth. If the number of regions is equal to 0 "
+               "(default), the global optimal cut it returned.",
+               py::arg("ground_truth_index"),
+               py::arg("num_regions") = 0);
+
+        cm.def("aggregated_optimal_partition",
+               &assesser_multi_t::aggregated_optimal_partition,
+               "Labelisation of the tree vertices that corresponds to the optimal cut with "
+               "the given number of regions w.r.t. the aggregated measure. If the number of regions is equal to 0 "
+               "(default), the global optimal cut it returned.",
+               py::arg("num_regions") = 0);
+
+        add_type_overloads<def_assesse_horizontal_cut_multiple_ground_truths<hg::tree>, HG_TEMPLATE_NUMERIC_TYPES>
+                (m,
+                 "Compute the fragmentation curves of the horizontal cuts in a hierarchy w.r.t. several ground truths "
+                 "and a given measure.");
     }
 }
\ No newline at end of file
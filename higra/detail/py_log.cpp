@@ -29,6 +29,54 @@ namespace py_log {
         m.def("get_trace", []() { return hg::logger::trace_enabled(); },
               "Get the state of function call tracing.");
 
+        m.def("is_profiling_available", []() {
+#ifdef HG_ENABLE_TRACE
+                  return true;
+#else
+                  return false;
+#endif
+              },
+              "True if the library was compiled with function tracing (HG_ENABLE_TRACE), "
+              "otherwise profiling measures are always empty.");
+
+        m.def("set_profiling", [](bool enabled, bool record_events) {
+                  hg::profiler::enabled() = enabled;
+                  hg::profiler::events_enabled() = record_events;
+              },
+              "Define if profiling of traced functions is enabled. "
+              "If record_events is True, each function call is also recorded as an event "
+              "(see export_profiling_trace).",
+              pybind11::arg("enabled"),
+              pybind11::arg("record_events") = false);
+
+        m.def("get_profiling", []() { return hg::profiler::enabled().load(); },
+              "Get the state of profiling.");
+
+        m.def("get_profiling_counters", []() {
+                  pybind11::dict res;
+                  for (auto &c: hg::profiler::snapshot()) {
+                      pybind11::dict d;
+                      d["calls"] = c.second.calls;
+                      d["time"] = c.second.time;
+                      d["allocated_bytes"] = c.second.allocated_bytes;
+                      res[pybind11::str(c.first)] = d;
+                  }
+                  return res;
+              },
+              "Snapshot of the profiling counters aggregated over all threads: a dictionary mapping each traced "
+              "function name to a dictionary with the number of calls, the total wall time in seconds, and the "
+              "number of bytes allocated for the results of the function.");
+
+        m.def("reset_profiling", []() { hg::profiler::reset(); },
+              "Reset all profiling counters and recorded events.");
+
+        m.def("export_profiling_trace", [](const std::string &filename) {
+                  hg::profiler::export_chrome_trace(filename);
+              },
+              "Save the recorded profiling events in the Chrome trace event JSON format "
+              "(can be opened with chrome://tracing or Perfetto).",
+              pybind11::arg("filename"));
+
         /*m.def("add_logger_callback",
         [](std::function<void(const std::string &)>  fun){
             hg::logger::callbacks().push_back(fun);
@@ -13,6 +13,7 @@
 #include "pybind11/stl.h"
 #include "pybind11/functional.h"
 #include "higra/utils.hpp"
+#include "higra/structure/array.hpp"
 #include <functional>
 
 
@@ -28,6 +29,25 @@ add_type_overloads(module_t & m, const char * doc, Args&&... args){
     add_type_overloads<F, Ts...>(m, "", std::forward<Args>(args)...);
 };
 
+/**
+ * Create a shared array on the buffer of the given 1d numpy array (pyarray or pytensor).
+ *
+ * No copy is performed if the numpy array is contiguous: the numpy array is then kept alive until the last copy of
+ * the shared array is destroyed (the GIL is acquired to release it).
+ */
+template<typename pyarray_t>
+hg::shared_array_1d<typename pyarray_t::value_type> borrow_numpy_array_1d(const pyarray_t &array) {
+    using value_type = typename pyarray_t::value_type;
+    hg_assert(array.dimension() == 1, "Input array must be a 1d array.");
+    if (array.size() > 1 && array.strides()[0] != 1) {
+        return hg::to_shared_array_1d(hg::array_1d<value_type>(array));
+    }
+    std::shared_ptr<void> owner(new pybind11::object(array), [](void *object) {
+        pybind11::gil_scoped_acquire acquire;
+        delete static_cast<pybind11::object *>(object);
+    });
+    return hg::make_shared_array_1d(const_cast<value_type *>(array.data()), array.size(), std::move(owner));
+}
 
 #if defined(__GNUC__) && !defined(__clang__)
 namespace workaround
@@ -50,7 +50,7 @@ namespace py_lca_fast {
     using namespace range_minimum_query_internal;
 
 
-    auto get_rmq_state_to_python(const rmq_sparse_table<index_t>::internal_state<array_1d> &state) {
+    auto get_rmq_state_to_python(const rmq_sparse_table<index_t>::internal_state<shared_array_1d> &state) {
         py::list list;
         for (auto &t: state.sparse_table) {
             list.append(std::move(t));
@@ -59,7 +59,7 @@ namespace py_lca_fast {
     }
 
 
-    auto get_rmq_state_to_python(const rmq_sparse_table_block<index_t>::internal_state<array_1d> &state) {
+    auto get_rmq_state_to_python(const rmq_sparse_table_block<index_t>::internal_state<shared_array_1d> &state) {
         py::list list;
 
         list.append(state.data_size);
@@ -78,22 +78,22 @@ namespace py_lca_fast {
     template<>
     auto get_rmq_state_from_python<range_minimum_query_internal::rmq_sparse_table<index_t>>(const py::list &list) {
 
-        std::vector<pyarray_1d<size_t>> sp;
+        std::vector<shared_array_1d<size_t>> sp;
         for (auto &e: list) {
-            sp.push_back(e.template cast<pyarray_1d<size_t>>());
+            sp.push_back(borrow_numpy_array_1d(e.template cast<pyarray_1d<size_t>>()));
         }
-        return range_minimum_query_internal::rmq_sparse_table<index_t>::internal_state<pyarray_1d>(sp);
+        return range_minimum_query_internal::rmq_sparse_table<index_t>::internal_state<shared_array_1d>(std::move(sp));
     }
 
     template<>
     auto
     get_rmq_state_from_python<range_minimum_query_internal::rmq_sparse_table_block<index_t>>(const py::list &list) {
-        return range_minimum_query_internal::rmq_sparse_table_block<index_t>::internal_state<pyarray_1d>(
+        return range_minimum_query_internal::rmq_sparse_table_block<index_t>::internal_state<shared_array_1d>(
                 list[0].template cast<index_t>(),
                 list[1].template cast<index_t>(),
                 list[2].template cast<index_t>(),
-                list[3].template cast<pyarray_1d<index_t>>(),
-                list[4].template cast<pyarray_1d<index_t>>(),
+                borrow_numpy_array_1d(list[3].template cast<pyarray_1d<index_t>>()),
+                borrow_numpy_array_1d(list[4].template cast<pyarray_1d<index_t>>()),
                 get_rmq_state_from_python<range_minimum_query_internal::rmq_sparse_table<index_t>>(
                         list[5].template cast<py::list>())
         );
@@ -111,11 +111,11 @@ namespace py_lca_fast {
 
     template<typename lca_t>
     auto get_lca_state_from_python(const py::list &list) {
-        using state_type = typename lca_t::template internal_state<pyarray_1d>;
+        using state_type = typename lca_t::template internal_state<shared_array_1d>;
         return state_type(
-                list[0].template cast<pyarray_1d<index_t>>(),
-                list[1].template cast<pyarray_1d<index_t>>(),
-                list[2].template cast<pyarray_1d<index_t>>(),
+                borrow_numpy_array_1d(list[0].template cast<pyarray_1d<index_t>>()),
+                borrow_numpy_array_1d(list[1].template cast<pyarray_1d<index_t>>()),
+                borrow_numpy_array_1d(list[2].template cast<pyarray_1d<index_t>>()),
                 get_rmq_state_from_python<typename lca_t::rmq_type>(list[3])
         );
     }
@@ -155,14 +155,16 @@ namespace py_lca_fast {
               [](const lca_t &l) {
                   return py::make_tuple(get_lca_state_to_python(l.get_state()));
               },
-              "Return an opaque structure representing the internal state of the object");
+              "Return an opaque structure representing the internal state of the object "
+              "(the arrays of the state share their buffers with the object)");
 
         c.def_static("_make_from_state",
                      [](py::tuple &t) {
                          return lca_t::make_from_state(
                                  get_lca_state_from_python<lca_t>(t[0].template cast<py::list>()));
                      },
-                     "Create a new lca_fast object from the saved state (see function get_state)");
+                     "Create a new lca_fast object from the saved state (see function get_state): the arrays of the "
+                     "state are used without copy.");
 
         return c;
     }
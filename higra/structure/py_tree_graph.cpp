@@ -75,10 +75,20 @@ namespace py_tree_graph {
         static
         void def(C &c, const char *doc) {
             c.def(py::init(
-                          [](const pyarray<type> &parent, hg::tree_category category) { return graph_t(parent, category); }),
+                          [](const pyarray<type> &parent, hg::tree_category category, bool copy, bool check) {
+                              hg_assert_1d_array(parent);
+                              if constexpr (std::is_same<type, vertex_t>::value) {
+                                  if (!copy) {
+                                      return graph_t(borrow_numpy_array_1d(parent), category, check);
+                                  }
+                              }
+                              return graph_t(hg::to_shared_array_1d(hg::array_1d<vertex_t>(parent)), category, check);
+                          }),
                   doc,
                   py::arg("parent_relation"),
-                  py::arg("category") = hg::tree_category::partition_tree
+                  py::arg("category") = hg::tree_category::partition_tree,
+                  py::arg("copy") = true,
+                  py::arg("check") = true
             );
         }
     };
@@ -202,7 +212,12 @@ namespace py_tree_graph {
                                      py::dynamic_attr());
 
         add_type_overloads<def_tree_ctr<graph_t>, HG_TEMPLATE_INTEGRAL_TYPES>
-                (c, "Create a tree from the given parent relation.");
+                (c, "Create a tree from the given parent relation.\n\n"
+                    "If :attr:`copy` is ``False`` and the parent relation is a contiguous array of type ``int64`` "
+                    "(possibly a memory mapped array), the tree directly uses its buffer: no copy is made and the "
+                    "array must not be modified during the lifetime of the tree. "
+                    "If :attr:`check` is ``False``, the parent relation is assumed to be a valid tree and "
+                    "is not verified.");
         add_edge_accessor_graph_concept<graph_t, decltype(c)>(c);
 
         ///////////////////////////////////
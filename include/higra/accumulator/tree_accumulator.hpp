@@ -85,6 +85,7 @@ namespace hg {
                 accs.back().finalize();
             }
 
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -152,6 +153,7 @@ namespace hg {
                 accs.back().finalize();
             }
 
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -245,6 +247,7 @@ namespace hg {
                 output_view.combine(input_view, combine);
             }
 
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -270,6 +273,7 @@ namespace hg {
                 output_view.set_position(i);
                 output_view = input_view;
             }
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -303,6 +307,7 @@ namespace hg {
                 output_view.set_position(i);
                 output_view = input_view;
             }
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -345,6 +350,7 @@ namespace hg {
                 }
 
             }
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -398,6 +404,7 @@ namespace hg {
                 acc.finalize();
             }
 
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
@@ -467,6 +474,7 @@ namespace hg {
 
             }
 
+            HG_TRACE_ALLOCATION(output);
             return output;
         };
 
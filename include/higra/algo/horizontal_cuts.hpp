@@ -12,6 +12,7 @@
 
 #include "tree.hpp"
 #include "graph_core.hpp"
+#include <numeric>
 
 namespace hg {
 
@@ -61,8 +62,61 @@ namespace hg {
                 altitude);
     }
 
+    template<typename explorer_t>
+    class horizontal_cut_incremental_labelisation;
+
+    /**
+     * Labelisations of the leaves of a hierarchy for several of its horizontal cuts stored in a compact
+     * label remap representation.
+     *
+     * As horizontal cuts are nested, the regions of the finest cut (called base regions) are included in the
+     * regions of every other cut. The labelisation of the tree leaves for the i-th cut is thus given by
+     * label_maps(i, leaf_labels(l)) for any leaf l.
+     *
+     * Labels are the indices of the cut nodes, as in horizontal_cut_nodes::labelisation_leaves.
+     */
+    struct horizontal_cuts_labelisations {
+
+        horizontal_cuts_labelisations(array_1d<index_t> &&_cut_indices,
+                                      array_1d<index_t> &&_leaf_labels,
+                                      array_2d<index_t> &&_label_maps) :
+                cut_indices(std::forward<array_1d<index_t> >(_cut_indices)),
+                leaf_labels(std::forward<array_1d<index_t> >(_leaf_labels)),
+                label_maps(std::forward<array_2d<index_t> >(_label_maps)) {
+        }
+
+        auto num_cuts() const {
+            return cut_indices.size();
+        }
+
+        /**
+         * Labelisation of the tree leaves for the i-th stored cut.
+         * @param i index of the cut in cut_indices
+         * @return a 1d array of size num_leaves(tree)
+         */
+        auto labelisation_leaves(index_t i) const {
+            return array_1d<index_t>(xt::index_view(xt::view(label_maps, i, xt::all()), leaf_labels));
+        }
+
+        /**
+         * Indices of the stored cuts in the horizontal cut explorer
+         */
+        array_1d<index_t> cut_indices;
+
+        /**
+         * Index of the base region (region of the finest stored cut) of each tree leaf
+         */
+        array_1d<index_t> leaf_labels;
+
+        /**
+         * label_maps(i, j) is the label of the j-th base region in the i-th stored cut
+         */
+        array_2d<index_t> label_maps;
+    };
+
     template<typename tree_t, typename value_t>
     class horizontal_cut_explorer {
+        friend class horizontal_cut_incremental_labelisation<horizontal_cut_explorer<tree_t, value_t>>;
     public:
         using tree_type = tree_t;
         using value_type = value_t;
@@ -171,8 +225,103 @@ namespace hg {
             return horizontal_cut_from_index(cut_index);
         }
 
+        /**
+         * Creates an object that maintains the labelisation of the tree leaves for a current horizontal cut, and
+         * that can update it incrementally when moving to the next (finer) or previous (coarser) cut: only
+         * the leaves of the regions which are split or merged are relabeled.
+         *
+         * @param cut_index index of the initial cut
+         * @return a horizontal_cut_incremental_labelisation
+         */
+        auto incremental_labelisation(index_t cut_index = 0) const {
+            return horizontal_cut_incremental_labelisation<horizontal_cut_explorer<tree_t, value_t>>(*this, cut_index);
+        }
+
+        /**
+         * Labelisations of the tree leaves for several horizontal cuts in the compact representation
+         * horizontal_cuts_labelisations.
+         *
+         * The cost is linear w.r.t. the number of nodes in the tree plus, for each cut, the number of regions
+         * in the finest requested cut.
+         *
+         * @tparam T
+         * @param xcut_indices indices of the horizontal cuts
+         * @return a horizontal_cuts_labelisations
+         */
+        template<typename T>
+        auto labelisations_from_indices(const xt::xexpression<T> &xcut_indices) const {
+            auto &cut_indices = xcut_indices.derived_cast();
+            hg_assert_1d_array(cut_indices);
+            hg_assert_integral_value_type(cut_indices);
+            hg_assert(cut_indices.size() > 0, "At least one cut index must be provided.");
+            hg_assert(xt::amin(cut_indices)() >= 0, "Cut index cannot be negative.");
+            hg_assert((index_t) xt::amax(cut_indices)() < (index_t) num_cuts(), "Cut index out of bounds.");
+
+            const tree &ct = current_tree();
+            auto &parents = ct.parents();
+            index_t finest_cut = xt::amax(cut_indices)();
+            index_t finest_split = first_split_node(finest_cut);
+
+            // base region of each node: the highest ancestor which is not split in the finest cut
+            array_1d<index_t> node_base_region = array_1d<index_t>::from_shape({num_vertices(ct)});
+            std::vector<index_t> base_nodes;
+            for (auto n: root_to_leaves_iterator(ct)) {
+                auto p = parents(n);
+                if (n >= finest_split) {
+                    node_base_region(n) = invalid_index;
+                } else if (p == n || p >= finest_split) {
+                    node_base_region(n) = base_nodes.size();
+                    base_nodes.push_back(n);
+                } else {
+                    node_base_region(n) = node_base_region(p);
+                }
+            }
+            array_1d<index_t> leaf_labels = xt::view(node_base_region, xt::range(0, num_leaves(ct)));
+
+            // process cuts from the finest to the coarsest: the region containing a base region in a coarser cut
+            // is an ancestor of its region in a finer cut
+            index_t num_requested_cuts = cut_indices.size();
+            std::vector<index_t> order(num_requested_cuts);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                             [&cut_indices](index_t i, index_t j) { return cut_indices(i) > cut_indices(j); });
+
+            std::vector<index_t> current_nodes(base_nodes);
+            array_2d<index_t> label_maps = array_2d<index_t>::from_shape({(size_t) num_requested_cuts,
+                                                                         base_nodes.size()});
+            for (auto i: order) {
+                index_t split = first_split_node(cut_indices(i));
+                for (index_t j = 0; j < (index_t) current_nodes.size(); j++) {
+                    auto n = current_nodes[j];
+                    while (parents(n) != n && parents(n) < split) {
+                        n = parents(n);
+                    }
+                    current_nodes[j] = n;
+                    label_maps(i, j) = (m_use_node_map) ? m_node_map(n) : n;
+                }
+            }
+            return horizontal_cuts_labelisations(array_1d<index_t>(cut_indices),
+                                                 std::move(leaf_labels),
+                                                 std::move(label_maps));
+        }
+
     private:
 
+        const tree &current_tree() const {
+            return (m_use_node_map) ? m_sorted_tree : m_original_tree;
+        }
+
+        /**
+         * Nodes of the sorted tree whose index is greater than or equal to first_split_node(i) are strictly above
+         * the i-th cut.
+         */
+        index_t first_split_node(index_t cut_index) const {
+            if (cut_index == 0) {
+                return num_vertices(current_tree());
+            }
+            return m_range_nodes_cuts[cut_index].first;
+        }
+
         template<typename T, typename E>
         void init(const T &t, const E &a) {
             auto min_alt_children = accumulate_parallel(t, a, accumulator_min());
@@ -225,6 +374,155 @@ namespace hg {
         std::vector<std::pair<index_t, index_t>> m_range_nodes_cuts;
     };
 
+    /**
+     * Labelisation of the leaves of a hierarchy that can be updated incrementally from one horizontal cut
+     * to the next (finer) or previous (coarser) cut: only the leaves of the regions that are split or merged
+     * between the two cuts are relabeled.
+     *
+     * Labels are the indices of the cut nodes, as in horizontal_cut_nodes::labelisation_leaves.
+     *
+     * The object keeps a reference to the horizontal cut explorer that created it.
+     *
+     * @tparam explorer_t horizontal cut explorer type
+     */
+    template<typename explorer_t>
+    class horizontal_cut_incremental_labelisation {
+    public:
+
+        horizontal_cut_incremental_labelisation(const explorer_t &explorer, index_t cut_index = 0) :
+                m_explorer(explorer) {
+            hg_assert(cut_index >= 0, "Cut index cannot be negative.");
+            hg_assert(cut_index < (index_t) explorer.num_cuts(), "Cut index out of bounds.");
+            const tree &ct = m_explorer.current_tree();
+            ct.compute_children();
+
+            // order the leaves such that the leaves of each node form a contiguous range
+            array_1d<index_t> area = array_1d<index_t>::from_shape({num_vertices(ct)});
+            xt::view(area, xt::range(0, num_leaves(ct))) = 1;
+            xt::view(area, xt::range(num_leaves(ct), num_vertices(ct))) = 0;
+            for (auto n: leaves_to_root_iterator(ct, leaves_it::include, root_it::exclude)) {
+                area(parent(n, ct)) += area(n);
+            }
+            m_leaves_start = array_1d<index_t>::from_shape({num_vertices(ct)});
+            m_leaves_end = array_1d<index_t>::from_shape({num_vertices(ct)});
+            m_leaves_order = array_1d<index_t>::from_shape({num_leaves(ct)});
+            m_leaves_start(root(ct)) = 0;
+            for (auto n: root_to_leaves_iterator(ct)) {
+                m_leaves_end(n) = m_leaves_start(n) + area(n);
+                if (is_leaf(n, ct)) {
+                    m_leaves_order(m_leaves_start(n)) = n;
+                } else {
+                    index_t start = m_leaves_start(n);
+                    for (auto c: children_iterator(n, ct)) {
+                        m_leaves_start(c) = start;
+                        start += area(c);
+                    }
+                }
+            }
+
+            m_labels = array_1d<index_t>::from_shape({num_leaves(ct)});
+            m_cut_index = 0;
+            relabel(root(ct));
+            set_cut(cut_index);
+        }
+
+        /**
+         * Index of the current cut
+         */
+        auto cut_index() const {
+            return m_cut_index;
+        }
+
+        auto num_regions() const {
+            return m_explorer.num_regions_cut(m_cut_index);
+        }
+
+        auto altitude() const {
+            return m_explorer.altitude_cut(m_cut_index);
+        }
+
+        /**
+         * Labelisation of the tree leaves for the current cut
+         */
+        const auto &labelisation_leaves() const {
+            return m_labels;
+        }
+
+        /**
+         * Move to the next (finer) cut.
+         * @return false if the current cut is already the finest one, true otherwise
+         */
+        bool next_cut() {
+            if (m_cut_index + 1 >= (index_t) m_explorer.num_cuts()) {
+                return false;
+            }
+            const tree &ct = m_explorer.current_tree();
+            index_t split_start = m_explorer.first_split_node(m_cut_index + 1);
+            index_t split_end = m_explorer.first_split_node(m_cut_index);
+            for (index_t n = split_start; n < split_end; n++) {
+                for (auto c: children_iterator(n, ct)) {
+                    if (c < split_start) {
+                        relabel(c);
+                    }
+                }
+            }
+            m_cut_index++;
+            return true;
+        }
+
+        /**
+         * Move to the previous (coarser) cut.
+         * @return false if the current cut is already the coarsest one, true otherwise
+         */
+        bool previous_cut() {
+            if (m_cut_index == 0) {
+                return false;
+            }
+            const tree &ct = m_explorer.current_tree();
+            index_t merge_start = m_explorer.first_split_node(m_cut_index);
+            index_t merge_end = m_explorer.first_split_node(m_cut_index - 1);
+            for (index_t n = merge_start; n < merge_end; n++) {
+                auto p = parent(n, ct);
+                if (p == n || p >= merge_end) {
+                    relabel(n);
+                }
+            }
+            m_cut_index--;
+            return true;
+        }
+
+        /**
+         * Move to the given cut by successive merges or splits.
+         * @param cut_index
+         */
+        void set_cut(index_t cut_index) {
+            hg_assert(cut_index >= 0, "Cut index cannot be negative.");
+            hg_assert(cut_index < (index_t) m_explorer.num_cuts(), "Cut index out of bounds.");
+            while (m_cut_index < cut_index) {
+                next_cut();
+            }
+            while (m_cut_index > cut_index) {
+                previous_cut();
+            }
+        }
+
+    private:
+
+        void relabel(index_t node) {
+            auto label = (m_explorer.m_use_node_map) ? m_explorer.m_node_map(node) : node;
+            for (index_t i = m_leaves_start(node); i < m_leaves_end(node); i++) {
+                m_labels(m_leaves_order(i)) = label;
+            }
+        }
+
+        const explorer_t &m_explorer;
+        index_t m_cut_index;
+        array_1d<index_t> m_labels;
+        array_1d<index_t> m_leaves_order;
+        array_1d<index_t> m_leaves_start;
+        array_1d<index_t> m_leaves_end;
+    };
+
     template<typename tree_t, typename T>
     decltype(auto) make_horizontal_cut_explorer(tree_t &&tree, T &&altitudes) {
         return horizontal_cut_explorer<tree_t, typename std::decay_t<T>::value_type>(
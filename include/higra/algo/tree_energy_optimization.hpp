@@ -11,6 +11,7 @@
 #pragma once
 
 #include <deque>
+#include <type_traits>
 #include <limits>
 #include <algorithm>
 #include "xtensor/views/xindex_view.hpp"
@@ -272,117 +273,306 @@ namespace hg {
             std::deque<lp_t> pieces;
         };
 
-        // stupid template metaprogramming for bpt function
-        template<bool vectorial>
-        struct container_bpt {
+        /**
+         * Pool of piecewise linear energy functions (see piecewise_linear_energy_function) stored in a structure of
+         * arrays layout.
+         *
+         * Each function is stored in a slot of fixed capacity: the origins and slopes of the pieces of all the
+         * functions are stored in three flat arrays. Released slots are recycled, so that a bottom-up computation on
+         * a tree only performs allocations when the number of live functions increases.
+         *
+         * Functions operations (sum and infimum) follow exactly the semantic of
+         * piecewise_linear_energy_function::sum and piecewise_linear_energy_function::infimum.
+         */
+        template<typename value_type=double>
+        class piecewise_linear_energy_function_pool {
+        public:
 
-        };
+            /**
+             * Read only view on a function stored in a pool. The view is invalidated by any slot allocation in the pool.
+             */
+            struct function_view {
+                const value_type *origin_x;
+                const value_type *origin_y;
+                const value_type *slope;
+                index_t size;
+
+                value_type operator()(index_t i, value_type x) const {
+                    return origin_y[i] + slope[i] * (x - origin_x[i]);
+                }
+            };
 
-        template<>
-        struct container_bpt<true> {
-            typedef array_2d<double> type;
+            /**
+             * @param capacity maximum number of pieces in a function
+             */
+            piecewise_linear_energy_function_pool(size_t capacity) :
+                    m_capacity(capacity),
+                    m_tmp_origin_x(capacity),
+                    m_tmp_origin_y(capacity),
+                    m_tmp_slope(capacity) {
+            }
 
-            template<typename T>
-            static auto init(const T &a) {
-                type res = type::from_shape({a.shape()[0] * 2 - 1, a.shape()[1]});
-                xt::view(res, xt::range(0, a.shape()[0]), xt::all()) = a;
-                return res;
+            /**
+             * Get a slot for a new empty function
+             */
+            index_t allocate() {
+                index_t slot;
+                if (!m_free_slots.empty()) {
+                    slot = m_free_slots.back();
+                    m_free_slots.pop_back();
+                } else {
+                    slot = m_sizes.size();
+                    m_sizes.push_back(0);
+                    m_origin_x.resize(m_origin_x.size() + m_capacity);
+                    m_origin_y.resize(m_origin_y.size() + m_capacity);
+                    m_slope.resize(m_slope.size() + m_capacity);
+                }
+                m_sizes[slot] = 0;
+                return slot;
             }
-        };
 
-        template<>
-        struct container_bpt<false> {
-            typedef array_1d<double> type;
+            void release(index_t slot) {
+                m_free_slots.push_back(slot);
+            }
 
-            template<typename T>
-            static auto init(const T &a) {
-                type res = type::from_shape({a.size() * 2 - 1});
-                xt::view(res, xt::range(0, a.size())) = a;
-                return res;
+            index_t size(index_t slot) const {
+                return m_sizes[slot];
             }
-        };
 
-        template<bool vectorial>
-        struct computation_helper {
-        };
+            function_view view(index_t slot) const {
+                auto offset = slot * m_capacity;
+                return {m_origin_x.data() + offset, m_origin_y.data() + offset, m_slope.data() + offset,
+                        m_sizes[slot]};
+            }
 
-        template<>
-        struct computation_helper<true> {
+            /**
+             * Set the function in the given slot to a single linear piece
+             */
+            void set_piece(index_t slot, value_type origin_x, value_type origin_y, value_type slope) {
+                auto offset = slot * m_capacity;
+                m_origin_x[offset] = origin_x;
+                m_origin_y[offset] = origin_y;
+                m_slope[offset] = slope;
+                m_sizes[slot] = 1;
+            }
 
-            template<typename T>
-            static
-            void add(T &a, index_t res, index_t i, index_t j) {
-                for (index_t c = 0; c < (index_t) a.shape()[1]; c++) {
-                    a(res, c) = a(i, c) + a(j, c);
-                }
+            /**
+             * Copy the given function into the given slot (the view may come from another pool)
+             */
+            void assign(index_t slot, const function_view &f) {
+                auto offset = slot * m_capacity;
+                std::copy(f.origin_x, f.origin_x + f.size, m_origin_x.begin() + offset);
+                std::copy(f.origin_y, f.origin_y + f.size, m_origin_y.begin() + offset);
+                std::copy(f.slope, f.slope + f.size, m_slope.begin() + offset);
+                m_sizes[slot] = f.size;
             }
 
-            template<typename T, typename Q>
-            static
-            auto
-            data_fidelity(const T &m, const T &m2, const Q &area, index_t i) {
-                double res = 0;
-                for (index_t c = 0; c < (index_t) m.shape()[1]; c++) {
-                    res += m2(i, c) - m(i, c) * m(i, c) / area(i);
+            /**
+             * Store the sum of the two given functions in the given slot. The computation is limited to the
+             * max_pieces largest (right most) pieces.
+             *
+             * The views may refer to the destination slot.
+             */
+            void sum(index_t slot, const function_view &f1, const function_view &f2, int max_pieces = 10) {
+                if (f2.size == 0) {
+                    assign(slot, f1);
+                    return;
+                } else if (f1.size == 0) {
+                    assign(slot, f2);
+                    return;
                 }
-                return res;
+
+                // pieces are computed from right to left in the temporary buffers
+                index_t count = 0;
+                index_t end = m_capacity;
+                index_t i1 = f1.size - 1;
+                index_t i2 = f2.size - 1;
+                while (i1 >= 0 && i2 >= 0 && count < max_pieces) {
+                    auto new_slope = f1.slope[i1] + f2.slope[i2];
+                    value_type new_origin_x, new_origin_y;
+                    if (f1.origin_x[i1] >= f2.origin_x[i2]) {
+                        new_origin_x = f1.origin_x[i1];
+                        new_origin_y = f1.origin_y[i1] + f2(i2, f1.origin_x[i1]);
+                        if (f1.origin_x[i1] == f2.origin_x[i2]) {
+                            i2--;
+                        }
+                        i1--;
+                    } else {
+                        new_origin_x = f2.origin_x[i2];
+                        new_origin_y = f2.origin_y[i2] + f1(i1, f2.origin_x[i2]);
+                        i2--;
+                    }
+                    end--;
+                    m_tmp_origin_x[end] = new_origin_x;
+                    m_tmp_origin_y[end] = new_origin_y;
+                    m_tmp_slope[end] = new_slope;
+                    count++;
+                }
+
+                if (count > 0 && m_tmp_origin_x[end] > 0) {
+                    m_tmp_origin_y[end] -= m_tmp_slope[end] * m_tmp_origin_x[end];
+                    m_tmp_origin_x[end] = 0;
+                }
+
+                auto offset = slot * m_capacity;
+                std::copy(m_tmp_origin_x.begin() + end, m_tmp_origin_x.end(), m_origin_x.begin() + offset);
+                std::copy(m_tmp_origin_y.begin() + end, m_tmp_origin_y.end(), m_origin_y.begin() + offset);
+                std::copy(m_tmp_slope.begin() + end, m_tmp_slope.end(), m_slope.begin() + offset);
+                m_sizes[slot] = count;
             }
 
-            template<typename Q, typename T, typename R>
-            static
-            auto
-            apparition_scale(const Q &oe, const T &area, const T &perimeter, const R &m, const R &m2,
-                             index_t i, index_t j, double edge_length) {
-                auto e = oe[i].sum(oe[j]);
-                double a = area(i) + area(j);
-                double data_fidelity = 0;
-                for (index_t c = 0; c < (index_t) m.shape()[1]; c++) {
-                    double mean = m(i, c) + m(j, c);
-                    double mean2 = m2(i, c) + m2(j, c);
-                    data_fidelity += mean2 - mean * mean / a;
+            /**
+             * Infimum, computed in place, between the function in the given slot and the linear piece
+             * passing through (0, origin_y) with the given slope.
+             *
+             * Returns the abscissa of the intersection between the two functions and infinity if no intersection exists
+             *
+             * See piecewise_linear_energy_function::infimum for preconditions.
+             */
+            value_type infimum(index_t slot, value_type origin_y, value_type slope) {
+                auto offset = slot * m_capacity;
+                auto *fx = m_origin_x.data() + offset;
+                auto *fy = m_origin_y.data() + offset;
+                auto *fs = m_slope.data() + offset;
+                auto linear_piece = [origin_y, slope](value_type x) { return origin_y + slope * x; };
+                index_t &size = m_sizes[slot];
+
+                index_t i = size - 1;
+                if (slope == fs[i]) {
+                    auto y = linear_piece(fx[i]);
+                    if (y > fy[i]) {
+                        return std::numeric_limits<value_type>::infinity();
+                    } else if (y == fy[i]) {
+                        return fx[i];
+                    } else {
+                        size--;
+                        i--;
+                    }
                 }
 
-                auto v = e.infimum({0,
-                                    data_fidelity,
-                                    perimeter(i) + perimeter(j) - 2 * edge_length});
-                return v;
+                value_type xi = 0;
+                bool flag = true;
+                while (i >= 0 && flag) {
+                    xi = (-fx[i] * fs[i] - (origin_y - fy[i])) / (slope - fs[i]);
+                    if (xi > fx[i]) {
+                        flag = false;
+                    } else {
+                        size--;
+                    }
+                    i--;
+                }
+                hg_assert(size < (index_t) m_capacity, "Piecewise linear energy function pool capacity exceeded.");
+                fx[size] = xi;
+                fy[size] = linear_piece(xi);
+                fs[size] = slope;
+                size++;
+                return xi;
             }
 
+        private:
+            index_t m_capacity;
+            std::vector<value_type> m_origin_x;
+            std::vector<value_type> m_origin_y;
+            std::vector<value_type> m_slope;
+            std::vector<index_t> m_sizes;
+            std::vector<index_t> m_free_slots;
+            std::vector<value_type> m_tmp_origin_x;
+            std::vector<value_type> m_tmp_origin_y;
+            std::vector<value_type> m_tmp_slope;
         };
 
-        template<>
-        struct computation_helper<false> {
+        /**
+         * Flat storage of the sums and sums of squares of the values of the regions of a Mumford-Shah binary
+         * partition tree.
+         *
+         * The statistics of a region are stored contiguously (sums followed by sums of squares) so that merging two
+         * regions is a single contiguous loop. When the template parameter dim is strictly positive, the number of
+         * channels is known at compile time and the loops over channels have a fixed trip count.
+         *
+         * @tparam dim number of channels, 0 if it is only known at runtime
+         */
+        template<index_t dim>
+        class mumford_shah_region_statistics {
+        public:
 
-            template<typename T>
-            static
-            void add(T &a, index_t res, index_t i, index_t j) {
-                a(res) = a(i) + a(j);
+            /**
+             * @param num_regions maximal number of regions
+             * @param num_channels number of channels (must be equal to dim if dim > 0)
+             */
+            mumford_shah_region_statistics(index_t num_regions, index_t num_channels) :
+                    m_num_channels(num_channels),
+                    m_data(num_regions * 2 * num_channels) {
+                hg_assert(dim == 0 || dim == num_channels, "Invalid number of channels.");
             }
 
-            template<typename T>
-            static
-            auto
-            data_fidelity(const T &m, const T &m2, const T &area, index_t i) {
-                return m2(i) - m(i) * m(i) / area(i);
+            index_t num_channels() const {
+                return (dim > 0) ? dim : m_num_channels;
             }
 
-            template<typename Q, typename T, typename R>
-            static
-            auto
-            apparition_scale(const Q &oe, const T &area, const T &perimeter, const R &m, const R &m2,
-                             index_t i, index_t j, double edge_length) {
-                auto e = oe[i].sum(oe[j]);
+            double *sum(index_t region) {
+                return m_data.data() + region * 2 * num_channels();
+            }
+
+            const double *sum(index_t region) const {
+                return m_data.data() + region * 2 * num_channels();
+            }
+
+            double *sum2(index_t region) {
+                return sum(region) + num_channels();
+            }
+
+            const double *sum2(index_t region) const {
+                return sum(region) + num_channels();
+            }
+
+            /**
+             * Statistics of region res are set to the union of the statistics of regions i and j
+             */
+            void merge(index_t res, index_t i, index_t j) {
+                const index_t size = 2 * num_channels();
+                const double *a = sum(i);
+                const double *b = sum(j);
+                double *r = sum(res);
+                for (index_t c = 0; c < size; c++) {
+                    r[c] = a[c] + b[c];
+                }
+            }
 
-                double mean = m(i) + m(j);
-                double mean2 = m2(i) + m2(j);
-                double a = area(i) + area(j);
+            /**
+             * Data fidelity of the given region of the given area
+             */
+            double data_fidelity(index_t i, double area) const {
+                const index_t num_c = num_channels();
+                const double *m = sum(i);
+                const double *m2 = sum2(i);
+                double res = 0;
+                for (index_t c = 0; c < num_c; c++) {
+                    res += m2[c] - m[c] * m[c] / area;
+                }
+                return res;
+            }
 
-                auto v = e.infimum({0,
-                                    mean2 - mean * mean / a,
-                                    perimeter(i) + perimeter(j) - 2 * edge_length});
-                return v;
+            /**
+             * Data fidelity of the union of the regions i and j whose total area is equal to area
+             */
+            double data_fidelity(index_t i, index_t j, double area) const {
+                const index_t num_c = num_channels();
+                const double *mi = sum(i);
+                const double *mj = sum(j);
+                const double *m2i = sum2(i);
+                const double *m2j = sum2(j);
+                double res = 0;
+                for (index_t c = 0; c < num_c; c++) {
+                    double mean = mi[c] + mj[c];
+                    double mean2 = m2i[c] + m2j[c];
+                    res += mean2 - mean * mean / area;
+                }
+                return res;
             }
 
+        private:
+            index_t m_num_channels;
+            std::vector<double> m_data;
         };
 
         /**
@@ -390,22 +580,24 @@ namespace hg {
          *
          * Consider using the helper factory function make_binary_partition_tree_MumfordShah_linkage
          *
-         * @tparam T
+         * @tparam dim number of channels of the region model, 0 if it is only known at runtime
         */
-        template<bool vectorial, typename graph_type, typename value_type=double>
+        template<index_t dim, typename graph_type, typename value_type=double>
         struct binary_partition_tree_MumfordShah_linkage_weighting_functor {
-            using ctype = typename container_bpt<vectorial>::type;
 
-            using lep_t = piecewise_linear_energy_function_piece<double>;
-            using lef_t = piecewise_linear_energy_function<double>;
+            using pool_t = piecewise_linear_energy_function_pool<double>;
+
+            // binary tree: a sum has at most 10 pieces and the infimum adds at most one piece
+            static const index_t max_pieces = 10;
 
-            std::vector<lef_t> m_optimal_energies{};
             const graph_type &m_graph;
+            pool_t m_optimal_energies;
+            array_1d<index_t> m_optimal_energies_slots;
+            index_t m_scratch_slot;
             array_1d<double> m_area;
             array_1d<double> m_perimeter;
             array_1d<double> m_edge_length;
-            ctype m_sum;
-            ctype m_sum2;
+            mumford_shah_region_statistics<dim> m_statistics;
 
             template<typename T1, typename T2, typename T3, typename T4, typename T5>
             binary_partition_tree_MumfordShah_linkage_weighting_functor(
@@ -416,7 +608,11 @@ namespace hg {
                     const xt::xexpression<T4> &xvertex_perimeter,
                     const xt::xexpression<T5> &xedge_length) :
                     m_graph(graph),
-                    m_edge_length(xedge_length) {
+                    m_optimal_energies(max_pieces + 1),
+                    m_edge_length(xedge_length),
+                    m_statistics(xvertex_area.derived_cast().size() * 2 - 1,
+                                 (xsum_vertex_weights.derived_cast().dimension() == 1) ? 1 :
+                                 xsum_vertex_weights.derived_cast().shape()[1]) {
                 auto &vertex_area = xvertex_area.derived_cast();
                 auto &sum_vertex_weights = xsum_vertex_weights.derived_cast();
                 auto &sum_square_vertex_weights = xsum_square_vertex_weights.derived_cast();
@@ -428,24 +624,48 @@ namespace hg {
                 xt::noalias(xt::view(m_area, xt::range(0, num_nodes))) = vertex_area;
                 m_perimeter = array_1d<double>::from_shape({num_nodes_final});
                 xt::noalias(xt::view(m_perimeter, xt::range(0, num_nodes))) = vertex_perimeter;
-                m_sum = container_bpt<vectorial>::init(sum_vertex_weights);
-                m_sum2 = container_bpt<vectorial>::init(sum_square_vertex_weights);
 
+                index_t num_channels = m_statistics.num_channels();
+                for (index_t i = 0; i < (index_t) num_nodes; i++) {
+                    auto m = m_statistics.sum(i);
+                    auto m2 = m_statistics.sum2(i);
+                    if (sum_vertex_weights.dimension() == 1) {
+                        m[0] = sum_vertex_weights(i);
+                        m2[0] = sum_square_vertex_weights(i);
+                    } else {
+                        for (index_t c = 0; c < num_channels; c++) {
+                            m[c] = sum_vertex_weights(i, c);
+                            m2[c] = sum_square_vertex_weights(i, c);
+                        }
+                    }
+                }
+
+                m_optimal_energies_slots = array_1d<index_t>::from_shape({num_nodes_final});
                 for (index_t i = 0; i < (index_t) num_nodes; i++) {
-                    m_optimal_energies.emplace_back(
-                            lep_t{0, computation_helper<vectorial>::data_fidelity(m_sum, m_sum2, m_area, i),
-                                  m_perimeter(i)});
+                    auto slot = m_optimal_energies.allocate();
+                    m_optimal_energies_slots(i) = slot;
+                    m_optimal_energies.set_piece(slot, 0, m_statistics.data_fidelity(i, m_area(i)), m_perimeter(i));
                 }
+                m_scratch_slot = m_optimal_energies.allocate();
+            }
+
+            /**
+             * Apparition scale of the region obtained by merging the regions i and j
+             */
+            double apparition_scale(index_t i, index_t j, double edge_length) {
+                m_optimal_energies.sum(m_scratch_slot,
+                                       m_optimal_energies.view(m_optimal_energies_slots(i)),
+                                       m_optimal_energies.view(m_optimal_energies_slots(j)),
+                                       max_pieces);
+                return m_optimal_energies.infimum(m_scratch_slot,
+                                                  m_statistics.data_fidelity(i, j, m_area(i) + m_area(j)),
+                                                  m_perimeter(i) + m_perimeter(j) - 2 * edge_length);
             }
 
             auto weight_initial_edges() {
                 array_1d<double> edge_weights = array_1d<double>::from_shape({num_edges(m_graph)});
                 for (auto e: edge_iterator(m_graph)) {
-                    auto s = source(e, m_graph);
-                    auto t = target(e, m_graph);
-                    edge_weights(e) = computation_helper<vectorial>::apparition_scale(
-                            m_optimal_energies, m_area, m_perimeter, m_sum, m_sum2,
-                            s, t, m_edge_length(e));
+                    edge_weights(e) = apparition_scale(source(e, m_graph), target(e, m_graph), m_edge_length(e));
                 }
                 return edge_weights;
             }
@@ -462,16 +682,20 @@ namespace hg {
                 m_perimeter(new_region) =
                         m_perimeter(merged_region1) + m_perimeter(merged_region2) -
                         2 * m_edge_length(fusion_edge_index);
-                computation_helper<vectorial>::add(m_sum, new_region, merged_region1, merged_region2);
-                computation_helper<vectorial>::add(m_sum2, new_region, merged_region1, merged_region2);
-
-                // compute energy of new region
-                m_optimal_energies.push_back(
-                        m_optimal_energies[merged_region1].sum(m_optimal_energies[merged_region2]));
-                m_optimal_energies[new_region].infimum(
-                        {0,
-                         computation_helper<vectorial>::data_fidelity(m_sum, m_sum2, m_area, new_region),
-                         m_perimeter(new_region)});
+                m_statistics.merge(new_region, merged_region1, merged_region2);
+
+                // compute energy of new region, the slots of the merged regions are recycled
+                auto slot = m_optimal_energies.allocate();
+                m_optimal_energies_slots(new_region) = slot;
+                m_optimal_energies.sum(slot,
+                                       m_optimal_energies.view(m_optimal_energies_slots(merged_region1)),
+                                       m_optimal_energies.view(m_optimal_energies_slots(merged_region2)),
+                                       max_pieces);
+                m_optimal_energies.infimum(slot,
+                                           m_statistics.data_fidelity(new_region, m_area(new_region)),
+                                           m_perimeter(new_region));
+                m_optimal_energies.release(m_optimal_energies_slots(merged_region1));
+                m_optimal_energies.release(m_optimal_energies_slots(merged_region2));
 
                 // update weights of edges linking the new region
                 for (auto &n: new_neighbours) {
@@ -487,9 +711,8 @@ namespace hg {
 
                     // the weight of the new edge is equal to the apparition scale of the region create by the merging of
                     // the two extremities of the edge
-                    n.new_edge_weight() = (std::max)(0.0, computation_helper<vectorial>::apparition_scale(
-                            m_optimal_energies, m_area, m_perimeter, m_sum, m_sum2,
-                            new_region, n.neighbour_vertex(), new_edge_length));
+                    n.new_edge_weight() = (std::max)(0.0, apparition_scale(new_region, n.neighbour_vertex(),
+                                                                           new_edge_length));
 
                 }
             }
@@ -628,26 +851,98 @@ namespace hg {
                   "approximation_piecewise_linear_function must be strictly positive.");
 
 
-        using lep_t = hg::tree_energy_optimization_internal::piecewise_linear_energy_function_piece<double>;
-        using lef_t = hg::tree_energy_optimization_internal::piecewise_linear_energy_function<double>;
+        using pool_t = hg::tree_energy_optimization_internal::piecewise_linear_energy_function_pool<double>;
 
         tree.compute_children();
-        std::vector<lef_t> optimal_energies{};
-        array_1d<double> apparition_scales = array_1d<double>::from_shape({num_vertices(tree)});
-
+        index_t num_nodes = num_vertices(tree);
+        array_1d<double> apparition_scales = array_1d<double>::from_shape({(size_t) num_nodes});
+
+        // number of nodes in each sub-tree and length of the longest chain of single child nodes:
+        // a function can only grow beyond max_pieces + 1 pieces along such chains (no sum truncation)
+        array_1d<index_t> subtree_size = array_1d<index_t>::from_shape({(size_t) num_nodes});
+        array_1d<index_t> single_child_chain = array_1d<index_t>::from_shape({(size_t) num_nodes});
+        index_t max_single_child_chain = 0;
         for (auto i: leaves_iterator(tree)) {
-            optimal_energies.emplace_back(lep_t(0, data_fidelity_attribute(i), regularization_attribute(i)));
-            apparition_scales(i) = -data_fidelity_attribute(i) / regularization_attribute(i);
+            subtree_size(i) = 1;
+            single_child_chain(i) = 0;
         }
-
         for (auto i: leaves_to_root_iterator(tree, leaves_it::exclude)) {
-            optimal_energies.push_back(optimal_energies[child(0, i, tree)]);
+            index_t size = 1;
+            for (auto c: children_iterator(i, tree)) {
+                size += subtree_size(c);
+            }
+            subtree_size(i) = size;
+            single_child_chain(i) = (num_children(i, tree) == 1) ? single_child_chain(child(0, i, tree)) + 1 : 0;
+            max_single_child_chain = (std::max)(max_single_child_chain, single_child_chain(i));
+        }
+        size_t capacity = approximation_piecewise_linear_function + 1 + max_single_child_chain;
+
+        // the optimal energy of node i is stored in slot slots(i) of pool pools[pool_index(i)]
+        array_1d<index_t> slots = array_1d<index_t>::from_shape({(size_t) num_nodes});
+        array_1d<index_t> pool_index = array_1d<index_t>::from_shape({(size_t) num_nodes});
+
+        auto process_node = [&](pool_t &pool, index_t pool_id, index_t i, std::vector<pool_t> &pools) {
+            auto slot = pool.allocate();
+            slots(i) = slot;
+            pool_index(i) = pool_id;
+            if (is_leaf(i, tree)) {
+                pool.set_piece(slot, 0, data_fidelity_attribute(i), regularization_attribute(i));
+                apparition_scales(i) = -data_fidelity_attribute(i) / regularization_attribute(i);
+                return;
+            }
+            auto child_view = [&](index_t c) {
+                return (pool_index(c) == pool_id) ? pool.view(slots(c)) : pools[pool_index(c)].view(slots(c));
+            };
+            pool.assign(slot, child_view(child(0, i, tree)));
             for (index_t c = 1; c < (index_t) num_children(i, tree); c++) {
-                optimal_energies[i] = optimal_energies[i].sum(optimal_energies[child(c, i, tree)],
-                                                              approximation_piecewise_linear_function);
+                pool.sum(slot, pool.view(slot), child_view(child(c, i, tree)),
+                         approximation_piecewise_linear_function);
+            }
+            apparition_scales(i) = pool.infimum(slot, data_fidelity_attribute(i), regularization_attribute(i));
+            for (auto c: children_iterator(i, tree)) {
+                if (pool_index(c) == pool_id) {
+                    pool.release(slots(c));
+                }
+            }
+        };
+
+        // independent sub-trees of at most grain_size nodes are processed in parallel, each with its own pool,
+        // the remaining top of the tree is then processed sequentially
+        index_t grain_size = (std::max)((index_t) 4096, num_nodes / 256);
+        std::vector<index_t> task_roots;
+        for (auto i: leaves_to_root_iterator(tree)) {
+            if (subtree_size(i) <= grain_size &&
+                (parent(i, tree) == i || subtree_size(parent(i, tree)) > grain_size)) {
+                task_roots.push_back(i);
+            }
+        }
+
+        index_t num_tasks = task_roots.size();
+        std::vector<pool_t> pools(num_tasks + 1, pool_t(capacity));
+        parfor(0, num_tasks, [&](index_t t) {
+            auto &pool = pools[t];
+            stackv<index_t> stack;
+            std::vector<index_t> preorder;
+            preorder.reserve(subtree_size(task_roots[t]));
+            stack.push(task_roots[t]);
+            while (!stack.empty()) {
+                auto n = stack.top();
+                stack.pop();
+                preorder.push_back(n);
+                for (auto c: children_iterator(n, tree)) {
+                    stack.push(c);
+                }
+            }
+            for (auto it = preorder.rbegin(); it != preorder.rend(); it++) {
+                process_node(pool, t, *it, pools);
+            }
+        });
+
+        auto &top_pool = pools[num_tasks];
+        for (auto i: leaves_to_root_iterator(tree)) {
+            if (subtree_size(i) > grain_size) {
+                process_node(top_pool, num_tasks, i, pools);
             }
-            apparition_scales(i) = optimal_energies[i].infimum(
-                    {0, data_fidelity_attribute(i), regularization_attribute(i)});
         }
 
         for (auto i: root_to_leaves_iterator(tree, leaves_it::include, root_it::exclude)) {
@@ -714,9 +1009,9 @@ namespace hg {
         hg_assert_edge_weights(graph, edge_length);
         hg_assert_1d_array(edge_length);
 
-        if (vertex_values.dimension() == 1) {
+        auto compute = [&](auto dim) {
             auto wf = tree_energy_optimization_internal::
-            binary_partition_tree_MumfordShah_linkage_weighting_functor<false, graph_t>(
+            binary_partition_tree_MumfordShah_linkage_weighting_functor<decltype(dim)::value, graph_t>(
                     graph,
                     vertex_area,
                     vertex_values,
@@ -726,20 +1021,19 @@ namespace hg {
             );
             auto edge_weights = wf.weight_initial_edges();
             return binary_partition_tree(graph, edge_weights, wf);
-        } else {
-            auto wf = tree_energy_optimization_internal::
-            binary_partition_tree_MumfordShah_linkage_weighting_functor<true, graph_t>(
-                    graph,
-                    vertex_area,
-                    vertex_values,
-                    squared_vertex_values,
-                    vertex_perimeter,
-                    edge_length
-            );
-            auto edge_weights = wf.weight_initial_edges();
-            auto res = binary_partition_tree(graph, edge_weights, wf);
+        };
 
-            return res;
+        // fixed size region models for common numbers of channels
+        index_t num_channels = (vertex_values.dimension() == 1) ? 1 : vertex_values.shape()[1];
+        switch (num_channels) {
+            case 1:
+                return compute(std::integral_constant<index_t, 1>());
+            case 3:
+                return compute(std::integral_constant<index_t, 3>());
+            case 4:
+                return compute(std::integral_constant<index_t, 4>());
+            default:
+                return compute(std::integral_constant<index_t, 0>());
         }
 
     }
@@ -11,25 +11,51 @@
 #include "../graph.hpp"
 #include "xtensor/views/xview.hpp"
 #include "../accumulator/tree_accumulator.hpp"
-#include "../structure/fibonacci_heap.hpp"
+#include "../structure/leftist_heap.hpp"
 #include "../structure/unionfind.hpp"
 
 namespace hg {
 
     namespace tree_monotonic_regression_internal {
 
-        struct heap_node {
-            double value;
-            index_t node_index;
-        };
+        /**
+         * Smallest increasing function above altitudes: single leaves to root pass on the parent array.
+         */
+        template<typename tree_t, typename T>
+        auto tree_monotonic_regression_max(const tree_t &tree, const xt::xexpression<T> &xaltitudes) {
+            auto &altitudes = xaltitudes.derived_cast();
+            using value_type = typename T::value_type;
 
-        // reverse order to obtain a max_heap
-        bool operator<(const heap_node &n1, const heap_node &n2) {
-            return n1.value > n2.value;
+            array_nd<value_type> result = altitudes;
+            for (index_t i: leaves_to_root_iterator(tree, leaves_it::include, root_it::exclude)) {
+                auto p = parent(i, tree);
+                if (result(p) < result(i)) {
+                    result(p) = result(i);
+                }
+            }
+            return result;
         }
 
-        using heap_type = fibonacci_heap<heap_node>;
-        using heap_element_type = heap_type::value_handle;
+        /**
+         * Largest increasing function below altitudes: single root to leaves pass on the parent array.
+         */
+        template<typename tree_t, typename T>
+        auto tree_monotonic_regression_min(const tree_t &tree, const xt::xexpression<T> &xaltitudes) {
+            auto &altitudes = xaltitudes.derived_cast();
+            using value_type = typename T::value_type;
+
+            array_nd<value_type> result = altitudes;
+            for (index_t i: root_to_leaves_iterator(tree, leaves_it::include, root_it::exclude)) {
+                auto p = parent(i, tree);
+                if (result(p) < result(i)) {
+                    result(i) = result(p);
+                }
+            }
+            return result;
+        }
+
+        // max heap on block average values
+        using heap_type = leftist_heap_forest<double, std::greater<double>>;
 
         template<typename tree_t, typename T, typename Tw>
         auto tree_monotonic_regression_least_square(const tree_t &tree, const xt::xexpression<T> &xaltitudes,
@@ -41,23 +67,19 @@ namespace hg {
             /*
              * Initialization
              */
-            array_1d<double> node_weight = weights;
+            index_t num_v = num_vertices(tree);
+            array_1d<double>::shape_type shape({(size_t) num_v});
             array_1d<double> node_block_total_weight = weights;
-            array_1d<double> node_value = altitudes;
-            array_1d<double> node_block_weighted_sum = node_weight * node_value;
+            array_1d<double> node_block_weighted_sum = weights * altitudes;
 
-            array_1d<double>::shape_type shape({num_vertices(tree)});
-            array_1d<heap_type> node_heap = array_1d<heap_type>::from_shape(shape);
-            array_1d<heap_element_type> node_heap_handles = array_1d<heap_element_type>::from_shape(shape);
-
-            for (index_t i: leaves_to_root_iterator(tree, leaves_it::include, root_it::exclude)) {
-                node_heap_handles(i) = node_heap(parent(i, tree)).push({node_value(i), i});
-            }
+            // all the heaps live in a single arena: element i of the arena represents the tree node i in the
+            // heap of its parent block, node_heap(i) is the root of the heap of the block whose representative is i
+            heap_type heaps(num_v);
+            array_1d<index_t> node_heap(shape, invalid_index);
 
             // lazy average
             auto node_average_weight = node_block_weighted_sum / node_block_total_weight;
 
-            index_t num_v = num_vertices(tree);
             union_find uf(num_v); // Block maintenance
 
             /*
@@ -68,10 +90,10 @@ namespace hg {
                 index_t ic = uf.find(i);
 
                 // while we have violators among our children, fuse current block with the block of the most important violator
-                while (!node_heap(ic).empty() &&
-                       node_average_weight(ic) < node_heap(ic).top()->get_value().value) {
-                    index_t k = node_heap(ic).top()->get_value().node_index; // index of violator child k
-                    node_heap(ic).pop();
+                while (!heap_type::empty(node_heap(ic)) &&
+                       node_average_weight(ic) < heaps.key(heaps.top(node_heap(ic)))) {
+                    index_t k = heaps.top(node_heap(ic)); // index of violator child k
+                    node_heap(ic) = heaps.pop(node_heap(ic));
 
                     index_t kc = uf.find(k); // index of the representative tree node for the block containing node k
 
@@ -85,12 +107,14 @@ namespace hg {
                     // merge block information
                     node_block_weighted_sum(ic) += node_block_weighted_sum(new_ik);
                     node_block_total_weight(ic) += node_block_total_weight(new_ik);
-                    node_heap(ic).merge(node_heap(new_ik));
+                    node_heap(ic) = heaps.merge(node_heap(ic), node_heap(new_ik));
+                    node_heap(new_ik) = invalid_index;
                 }
 
-                // update parent heap to reflect the new weight of the block containing node i
+                // the block containing node i is final until the parent of i is processed: insert it in the parent heap
                 if (root(tree) != i) {
-                    node_heap(parent(i, tree)).update(node_heap_handles(i), {node_average_weight(ic), i});
+                    auto p = parent(i, tree);
+                    node_heap(p) = heaps.push(node_heap(p), i, node_average_weight(ic));
                 }
             }
 
@@ -151,7 +175,6 @@ namespace hg {
         auto &weights = xweights.derived_cast();
         hg_assert_node_weights(tree, altitudes);
         hg_assert_1d_array(altitudes);
-        using value_type = typename T::value_type;
 
         bool has_weights = false;
 
@@ -167,20 +190,13 @@ namespace hg {
                 HG_LOG_WARNING("The argument 'weights' is ignored with the given mode 'max'");
             }
 
-            auto leaf_altitudes = xt::view(altitudes, xt::range(0, num_leaves(tree)));
-            return accumulate_and_combine_sequential(tree,
-                                                     altitudes,
-                                                     leaf_altitudes,
-                                                     accumulator_max(),
-                                                     [](const value_type &x1, const value_type &x2) {
-                                                         return std::max(x1, x2);
-                                                     });
+            return tree_monotonic_regression_internal::tree_monotonic_regression_max(tree, altitudes);
         } else if (mode == "min") {
             if (has_weights) {
                 HG_LOG_WARNING("The argument 'weights' is ignored with the given mode 'min'");
             }
 
-            return propagate_sequential_and_accumulate(tree, altitudes, accumulator_min());
+            return tree_monotonic_regression_internal::tree_monotonic_regression_min(tree, altitudes);
         } else if (mode == "least_square") {
             if (has_weights) {
                 return tree_monotonic_regression_internal::tree_monotonic_regression_least_square(tree, altitudes,
@@ -88,6 +88,11 @@ namespace hg {
             size_t back_track_k_right; // number of regions coming from right/second  child
         };
 
+        /**
+         * For each node n of the tree, and each number of regions k, the best cut of the sub-tree rooted in n with k regions
+         */
+        using backtracking_table = std::vector<std::vector<dynamic_node>>;
+
         template<typename value_t=index_t, typename tree_t, typename T>
         auto compute_card_intersection_tree_ground_truth(
                 const tree_t &tree,
@@ -115,86 +120,51 @@ namespace hg {
             return card_intersection;
         };
 
-    }
-
-    /**
-     * This class is used to assess the optimal cuts of a hierarchy of partitions with respect to
-     * a given ground-truth labelisation of its base graph and the BCE measure.
-     */
-    class assesser_fragmentation_optimal_cut {
-    public:
-
         /**
-         * Create an assesser for hierarchy optimal cuts w.r.t. a given ground-truth partition of hierarchy
-         * leaves and the BCE quality measure. The algorithms will explore optimal cuts containing at most
-         * max_regions regions.
-         *
-         * The ground truth labelisation must be normalized (i.e. its labels must be positive integers
-         * in the interval [0, num_regions[).
-         *
-         * @tparam tree_t tree type
-         * @tparam T type of labels
-         * @param tree input hierarchy
-         * @param xground_truth ground truth labelisation of the tree leaves
-         * @param vertex_map super-vertices map (if tree is built on a rag, leave empty otherwise)
-         * @param max_regions maximum number of regions in the considered cuts.
+         * Area of the tree nodes expressed in number of vertices of the base graph.
          */
-        template<typename tree_t, typename T>
-        assesser_fragmentation_optimal_cut(
-                const tree_t &tree,
-                const xt::xexpression<T> &xground_truth,
-                optimal_cut_measure measure,
-                const array_1d<index_t> &vertex_map = {},
-                size_t max_regions = 200):
-                m_tree(tree) {
-            auto &ground_truth = xground_truth.derived_cast();
-
-            hg_assert_1d_array(ground_truth);
-            hg_assert_integral_value_type(ground_truth);
-
-            m_tree.compute_children();
-
-            max_regions = (std::min)(max_regions, num_leaves(m_tree));
-
-            size_t num_regions_ground_truth = xt::amax(ground_truth)() + 1;
-
-            array_1d<index_t> region_gt_areas({num_regions_ground_truth}, 0);
-            for (auto v:ground_truth) {
-                region_gt_areas[v]++;
-            }
-
-            m_num_regions_ground_truth = xt::count_nonzero(region_gt_areas)();
-
+        template<typename tree_t>
+        auto compute_region_tree_area(const tree_t &tree, const array_1d<index_t> &vertex_map = {}) {
 // TODO remove when xtensor MSVC witht he bug with xt::view(region_tree_area, xt::all(), xt::newaxis()) on 1d tensor
 #ifndef _MSC_VER
             array_1d<index_t> region_tree_area;
 #else
             array_nd<index_t> region_tree_area;
 #endif
-
-            // for a tree node i, a gt region j: card_intersection(i, j) is the number of pixels in R_i cap R_j
-            array_2d<index_t> card_intersection_leaves{{num_leaves(m_tree), region_gt_areas.size()}, 0};
             if (vertex_map.size() <= 1) { // no rag
-                hg_assert_leaf_weights(m_tree, ground_truth);
-                for (auto i: leaves_iterator(m_tree)) {
-                    card_intersection_leaves(i, ground_truth(i))++;
-                }
-                region_tree_area = attribute_area(m_tree);
+                region_tree_area = attribute_area(tree);
             } else { // tree on rag
-                hg_assert(vertex_map.size() == ground_truth.size(), "Vertex map and ground truth sizes do not match.");
-                for (index_t i = 0; i < (index_t) vertex_map.size(); i++) {
-                    card_intersection_leaves(vertex_map(i), ground_truth(i))++;
-                }
-                region_tree_area = attribute_area(m_tree,
+                region_tree_area = attribute_area(tree,
                                                   rag_accumulate(vertex_map, xt::ones<index_t>(vertex_map.shape()),
                                                                  accumulator_counter()));
             }
+            return region_tree_area;
+        }
 
-            array_2d<double> card_intersection = accumulate_sequential(m_tree, card_intersection_leaves,
-                                                                       accumulator_sum());
+        /**
+         * Area of each region of the ground truth labelisation.
+         */
+        template<typename T>
+        auto compute_region_ground_truth_area(const xt::xexpression<T> &xground_truth) {
+            auto &ground_truth = xground_truth.derived_cast();
+            size_t num_regions_ground_truth = xt::amax(ground_truth)() + 1;
 
-            array_1d<double> scores;
+            array_1d<index_t> region_gt_areas({num_regions_ground_truth}, 0);
+            for (auto v:ground_truth) {
+                region_gt_areas[v]++;
+            }
+            return region_gt_areas;
+        }
 
+        /**
+         * Score of each tree node, considered as a single region, w.r.t. the given measure.
+         */
+        template<typename T1, typename T2, typename T3>
+        array_1d<double> compute_optimal_cut_node_scores(optimal_cut_measure measure,
+                                                         const T1 &card_intersection,
+                                                         const T2 &region_gt_areas,
+                                                         const T3 &region_tree_area) {
+            array_1d<double> scores;
             switch (measure) {
                 case optimal_cut_measure::BCE:
                     scores = xt::eval(xt::sum(
@@ -212,19 +182,33 @@ namespace hg {
                     scores = xt::eval(xt::amax(card_intersection / card_union, {1}) * region_tree_area);
                     break;
             }
+            return scores;
+        }
+
+        /**
+         * Dynamic programming computation of the optimal cuts with at most max_regions regions of the given
+         * binary tree w.r.t. the given node scores.
+         */
+        template<typename tree_t, typename T>
+        auto compute_optimal_cut_backtracking(const tree_t &tree,
+                                              const xt::xexpression<T> &xscores,
+                                              size_t max_regions) {
+            auto &scores = xscores.derived_cast();
+            backtracking_table backtracking;
+            backtracking.reserve(num_vertices(tree));
 
             // initialize scoring for single region partitions (the node itself)
-            for (auto i: leaves_to_root_iterator(m_tree)) {
-                backtracking.push_back({{1, scores(i), 0, 0}});
+            for (auto i: leaves_to_root_iterator(tree)) {
+                backtracking.push_back({{1, (double) scores(i), 0, 0}});
             }
 
-            for (auto i: leaves_to_root_iterator(m_tree, leaves_it::exclude)) {
-                hg_assert(num_children(i, m_tree) == 2, "Only binary trees are supported.");
+            for (auto i: leaves_to_root_iterator(tree, leaves_it::exclude)) {
+                hg_assert(num_children(i, tree) == 2, "Only binary trees are supported.");
 
                 auto &backtrack_i = backtracking[i];
 
-                auto c1 = child(0, i, m_tree);
-                auto c2 = child(1, i, m_tree);
+                auto c1 = child(0, i, tree);
+                auto c2 = child(1, i, tree);
                 auto &backtrack_c1 = backtracking[c1];
                 auto &backtrack_c2 = backtracking[c2];
 
@@ -250,32 +234,29 @@ namespace hg {
                     }
                 }
             }
+            return backtracking;
         }
 
-        /**
-         * Fragmentation curve, i.e. for each number of region k between 1 and max_regions,
-         * the BCE score of the optimal cut with k regions.
-         * @return a fragmentation_curve
-         */
-        auto fragmentation_curve() const {
-            auto &backtrack_root = backtracking[root(m_tree)];
+        template<typename tree_t>
+        auto fragmentation_curve_from_backtracking(const tree_t &tree,
+                                                   const backtracking_table &backtracking,
+                                                   size_t num_regions_ground_truth) {
+            auto &backtrack_root = backtracking[root(tree)];
             array_1d<double> final_scores({backtrack_root.size()}, 0);
             for (index_t i = 0; i < (index_t) backtrack_root.size(); i++) {
                 final_scores(i) = backtrack_root[i].score;
             }
 
             return hg::fragmentation_curve<>{
-                    xt::eval(xt::arange<double>(1, (double)((index_t)final_scores.size() + 1))),
-                    xt::eval(final_scores / (double) num_leaves(m_tree)),
-                    m_num_regions_ground_truth};
+                    xt::eval(xt::arange<double>(1, (double) ((index_t) final_scores.size() + 1))),
+                    xt::eval(final_scores / (double) num_leaves(tree)),
+                    num_regions_ground_truth};
         }
 
-        /**
-         * Number of regions in the optimal cut
-         * @return
-         */
-        auto optimal_number_of_regions() const {
-            auto &backtrack_root = backtracking[root(m_tree)];
+        template<typename tree_t>
+        auto optimal_number_of_regions_from_backtracking(const tree_t &tree,
+                                                         const backtracking_table &backtracking) {
+            auto &backtrack_root = backtracking[root(tree)];
             return 1 + std::distance(
                     backtrack_root.begin(),
                     std::max_element(backtrack_root.begin(),
@@ -283,33 +264,26 @@ namespace hg {
                                      [](const auto &a, const auto &b) { return a.score < b.score; }));
         }
 
-        /**
-         * Score of the optimal cut
-         * @return
-         */
-        auto optimal_score() const {
-            auto &backtrack_root = backtracking[root(m_tree)];
+        template<typename tree_t>
+        auto optimal_score_from_backtracking(const tree_t &tree,
+                                             const backtracking_table &backtracking) {
+            auto &backtrack_root = backtracking[root(tree)];
             return std::max_element(backtrack_root.begin(),
                                     backtrack_root.end(),
                                     [](const auto &a, const auto &b) { return a.score < b.score; }
-            )->score / (double) num_leaves(m_tree);
+            )->score / (double) num_leaves(tree);
         }
 
-        /**
-         * Labelisation of the base graph that corresponds to the optimal cut with
-         * the given number of regions. If the number of regions is equal to 0 (default),
-         * the global optimal cut it returned (it will contain get_optimal_number_of_regions regions).
-         *
-         * @param num_regions
-         * @return
-         */
-        auto optimal_partition(size_t num_regions = 0) const {
+        template<typename tree_t>
+        auto optimal_partition_from_backtracking(const tree_t &tree,
+                                                 const backtracking_table &backtracking,
+                                                 size_t num_regions) {
             if (num_regions == 0) {
-                num_regions = optimal_number_of_regions();
+                num_regions = optimal_number_of_regions_from_backtracking(tree, backtracking);
             }
-            array_1d<bool> non_cut_nodes({num_vertices(m_tree)}, true);
+            array_1d<bool> non_cut_nodes({num_vertices(tree)}, true);
             std::stack<std::pair<index_t, size_t>> s;
-            s.push({root(m_tree), num_regions});
+            s.push({root(tree), num_regions});
             while (!s.empty()) {
                 index_t n;
                 size_t k_n;
@@ -319,16 +293,112 @@ namespace hg {
                 non_cut_nodes[n] = false;
 
                 if (node.back_track_k_left != 0) { // && node.back_track_k_right != 0
-                    s.push({child(0, n, m_tree), node.back_track_k_left});
-                    s.push({child(1, n, m_tree), node.back_track_k_right});
+                    s.push({child(0, n, tree), node.back_track_k_left});
+                    s.push({child(1, n, tree), node.back_track_k_right});
                 }
 
             }
-            return reconstruct_leaf_data(m_tree,
-                                         xt::arange(num_vertices(m_tree)),
+            return reconstruct_leaf_data(tree,
+                                         xt::arange(num_vertices(tree)),
                                          non_cut_nodes);
         }
 
+    }
+
+    /**
+     * This class is used to assess the optimal cuts of a hierarchy of partitions with respect to
+     * a given ground-truth labelisation of its base graph and the BCE measure.
+     */
+    class assesser_fragmentation_optimal_cut {
+    public:
+
+        /**
+         * Create an assesser for hierarchy optimal cuts w.r.t. a given ground-truth partition of hierarchy
+         * leaves and the BCE quality measure. The algorithms will explore optimal cuts containing at most
+         * max_regions regions.
+         *
+         * The ground truth labelisation must be normalized (i.e. its labels must be positive integers
+         * in the interval [0, num_regions[).
+         *
+         * @tparam tree_t tree type
+         * @tparam T type of labels
+         * @param tree input hierarchy
+         * @param xground_truth ground truth labelisation of the tree leaves
+         * @param vertex_map super-vertices map (if tree is built on a rag, leave empty otherwise)
+         * @param max_regions maximum number of regions in the considered cuts.
+         */
+        template<typename tree_t, typename T>
+        assesser_fragmentation_optimal_cut(
+                const tree_t &tree,
+                const xt::xexpression<T> &xground_truth,
+                optimal_cut_measure measure,
+                const array_1d<index_t> &vertex_map = {},
+                size_t max_regions = 200):
+                m_tree(tree) {
+            using namespace fragmentation_curve_internal;
+            auto &ground_truth = xground_truth.derived_cast();
+
+            hg_assert_1d_array(ground_truth);
+            hg_assert_integral_value_type(ground_truth);
+
+            m_tree.compute_children();
+
+            max_regions = (std::min)(max_regions, num_leaves(m_tree));
+
+            auto region_gt_areas = compute_region_ground_truth_area(ground_truth);
+            m_num_regions_ground_truth = xt::count_nonzero(region_gt_areas)();
+
+            auto region_tree_area = compute_region_tree_area(m_tree, vertex_map);
+
+            // for a tree node i, a gt region j: card_intersection(i, j) is the number of pixels in R_i cap R_j
+            auto card_intersection = compute_card_intersection_tree_ground_truth<double>(m_tree, ground_truth,
+                                                                                         vertex_map);
+
+            auto scores = compute_optimal_cut_node_scores(measure, card_intersection, region_gt_areas,
+                                                          region_tree_area);
+
+            backtracking = compute_optimal_cut_backtracking(m_tree, scores, max_regions);
+        }
+
+        /**
+         * Fragmentation curve, i.e. for each number of region k between 1 and max_regions,
+         * the BCE score of the optimal cut with k regions.
+         * @return a fragmentation_curve
+         */
+        auto fragmentation_curve() const {
+            return fragmentation_curve_internal::fragmentation_curve_from_backtracking(m_tree, backtracking,
+                                                                                       m_num_regions_ground_truth);
+        }
+
+        /**
+         * Number of regions in the optimal cut
+         * @return
+         */
+        auto optimal_number_of_regions() const {
+            return fragmentation_curve_internal::optimal_number_of_regions_from_backtracking(m_tree, backtracking);
+        }
+
+        /**
+         * Score of the optimal cut
+         * @return
+         */
+        auto optimal_score() const {
+            return fragmentation_curve_internal::optimal_score_from_backtracking(m_tree, backtracking);
+        }
+
+        /**
+         * Labelisation of the base graph that corresponds to the optimal cut with
+         * the given number of regions. If the number of regions is equal to 0 (default),
+         * the global optimal cut it returned (it will contain get_optimal_number_of_regions regions).
+         *
+         * @param num_regions
+         * @return
+         */
+        auto optimal_partition(size_t num_regions = 0) const {
+            return fragmentation_curve_internal::optimal_partition_from_backtracking(m_tree, backtracking,
+                                                                                     num_regions);
+        }
+
         /**
          * Compute tree node altitudes such that the horizontal cut of the resulting vertex valued hierarchy
          * corresponds to the optimal cut of the tree.
@@ -383,11 +453,226 @@ namespace hg {
 
 
     private:
-        std::vector<std::vector<fragmentation_curve_internal::dynamic_node>> backtracking;
+        fragmentation_curve_internal::backtracking_table backtracking;
         const hg::tree m_tree;
         size_t m_num_regions_ground_truth;
     };
 
+    /**
+     * This class is used to assess the optimal cuts of a hierarchy of partitions with respect to
+     * several ground-truth labelisations of its base graph (for example the different human annotations of an image).
+     *
+     * Tree preprocessing (children computation, region areas) is shared between all the ground-truths and the
+     * different ground-truths are processed in parallel.
+     *
+     * Results are available for each ground-truth independently, and for the aggregated measure defined as the
+     * mean of the scores obtained for each ground-truth. Aggregated optimal cuts are thus the cuts maximizing
+     * the average score over all the ground-truths.
+     */
+    class assesser_fragmentation_optimal_cut_multiple_ground_truths {
+    public:
+
+        /**
+         * Create an assesser for hierarchy optimal cuts w.r.t. several ground-truth partitions of hierarchy
+         * leaves and the given quality measure. The algorithms will explore optimal cuts containing at most
+         * max_regions regions.
+         *
+         * The ground truth labelisations must be normalized (i.e. their labels must be positive integers
+         * in the interval [0, num_regions[).
+         *
+         * @tparam tree_t tree type
+         * @tparam T type of labels
+         * @param tree input hierarchy
+         * @param xground_truths 2d array of size num_ground_truths x num_base_graph_vertices: each line is a ground truth labelisation of the tree base graph
+         * @param vertex_map super-vertices map (if tree is built on a rag, leave empty otherwise)
+         * @param max_regions maximum number of regions in the considered cuts.
+         */
+        template<typename tree_t, typename T>
+        assesser_fragmentation_optimal_cut_multiple_ground_truths(
+                const tree_t &tree,
+                const xt::xexpression<T> &xground_truths,
+                optimal_cut_measure measure,
+                const array_1d<index_t> &vertex_map = {},
+                size_t max_regions = 200):
+                m_tree(tree) {
+            using namespace fragmentation_curve_internal;
+            auto &ground_truths = xground_truths.derived_cast();
+
+            hg_assert(ground_truths.dimension() == 2, "Ground truths must be a 2d array.");
+            hg_assert(ground_truths.shape()[0] > 0, "At least one ground truth must be provided.");
+            hg_assert_integral_value_type(ground_truths);
+
+            m_tree.compute_children();
+
+            max_regions = (std::min)(max_regions, num_leaves(m_tree));
+
+            auto region_tree_area = compute_region_tree_area(m_tree, vertex_map);
+
+            index_t num_ground_truths = ground_truths.shape()[0];
+            m_backtracking.resize(num_ground_truths);
+            m_num_regions_ground_truth.resize(num_ground_truths);
+            std::vector<array_1d<double>> node_scores(num_ground_truths);
+
+            parfor(0, num_ground_truths, [&](index_t i) {
+                auto ground_truth = xt::view(ground_truths, i, xt::all());
+
+                auto region_gt_areas = compute_region_ground_truth_area(ground_truth);
+                m_num_regions_ground_truth[i] = xt::count_nonzero(region_gt_areas)();
+
+                auto card_intersection = compute_card_intersection_tree_ground_truth<double>(m_tree, ground_truth,
+                                                                                             vertex_map);
+
+                node_scores[i] = compute_optimal_cut_node_scores(measure, card_intersection, region_gt_areas,
+                                                                 region_tree_area);
+
+                m_backtracking[i] = compute_optimal_cut_backtracking(m_tree, node_scores[i], max_regions);
+            });
+
+            // the measures are additive over the regions of a cut: the optimal cut w.r.t. the mean measure is
+            // given by the mean of the node scores
+            array_1d<double> mean_node_scores = node_scores[0];
+            for (index_t i = 1; i < num_ground_truths; i++) {
+                mean_node_scores += node_scores[i];
+            }
+            mean_node_scores /= (double) num_ground_truths;
+            m_backtracking_aggregated = compute_optimal_cut_backtracking(m_tree, mean_node_scores, max_regions);
+
+            double mean_num_regions_ground_truth = 0;
+            for (auto n: m_num_regions_ground_truth) {
+                mean_num_regions_ground_truth += (double) n;
+            }
+            m_num_regions_ground_truth_aggregated =
+                    (size_t) std::round(mean_num_regions_ground_truth / (double) num_ground_truths);
+        }
+
+        /**
+         * Number of ground truths evaluated by the assesser
+         * @return
+         */
+        auto num_ground_truths() const {
+            return m_backtracking.size();
+        }
+
+        /**
+         * Fragmentation curve of the given ground truth, i.e. for each number of region k between 1 and max_regions,
+         * the score of the optimal cut with k regions.
+         *
+         * @param ground_truth_index index of the ground truth
+         * @return a fragmentation_curve
+         */
+        auto fragmentation_curve(index_t ground_truth_index) const {
+            assert_ground_truth_index(ground_truth_index);
+            return fragmentation_curve_internal::fragmentation_curve_from_backtracking(
+                    m_tree, m_backtracking[ground_truth_index], m_num_regions_ground_truth[ground_truth_index]);
+        }
+
+        /**
+         * Fragmentation curve of all the ground truths
+         * @return a vector of fragmentation_curve
+         */
+        auto fragmentation_curves() const {
+            std::vector<hg::fragmentation_curve<>> curves;
+            for (index_t i = 0; i < (index_t) num_ground_truths(); i++) {
+                curves.push_back(fragmentation_curve(i));
+            }
+            return curves;
+        }
+
+        /**
+         * Aggregated fragmentation curve, i.e. for each number of region k between 1 and max_regions,
+         * the mean score over all the ground truths of the cut with k regions maximizing this mean score.
+         *
+         * The number of regions of the ground truth associated to this curve is the rounded mean of the number of
+         * regions of all the ground truths.
+         *
+         * @return a fragmentation_curve
+         */
+        auto aggregated_fragmentation_curve() const {
+            return fragmentation_curve_internal::fragmentation_curve_from_backtracking(
+                    m_tree, m_backtracking_aggregated, m_num_regions_ground_truth_aggregated);
+        }
+
+        /**
+         * Number of regions in the optimal cut for the given ground truth
+         * @param ground_truth_index index of the ground truth
+         * @return
+         */
+        auto optimal_number_of_regions(index_t ground_truth_index) const {
+            assert_ground_truth_index(ground_truth_index);
+            return fragmentation_curve_internal::optimal_number_of_regions_from_backtracking(
+                    m_tree, m_backtracking[ground_truth_index]);
+        }
+
+        /**
+         * Number of regions in the optimal cut w.r.t. the aggregated measure
+         * @return
+         */
+        auto aggregated_optimal_number_of_regions() const {
+            return fragmentation_curve_internal::optimal_number_of_regions_from_backtracking(
+                    m_tree, m_backtracking_aggregated);
+        }
+
+        /**
+         * Score of the optimal cut for the given ground truth
+         * @param ground_truth_index index of the ground truth
+         * @return
+         */
+        auto optimal_score(index_t ground_truth_index) const {
+            assert_ground_truth_index(ground_truth_index);
+            return fragmentation_curve_internal::optimal_score_from_backtracking(
+                    m_tree, m_backtracking[ground_truth_index]);
+        }
+
+        /**
+         * Score of the optimal cut w.r.t. the aggregated measure
+         * @return
+         */
+        auto aggregated_optimal_score() const {
+            return fragmentation_curve_internal::optimal_score_from_backtracking(m_tree, m_backtracking_aggregated);
+        }
+
+        /**
+         * Labelisation of the base graph that corresponds to the optimal cut with
+         * the given number of regions for the given ground truth.
+         * If the number of regions is equal to 0 (default), the global optimal cut it returned.
+         *
+         * @param ground_truth_index index of the ground truth
+         * @param num_regions
+         * @return
+         */
+        auto optimal_partition(index_t ground_truth_index, size_t num_regions = 0) const {
+            assert_ground_truth_index(ground_truth_index);
+            return fragmentation_curve_internal::optimal_partition_from_backtracking(
+                    m_tree, m_backtracking[ground_truth_index], num_regions);
+        }
+
+        /**
+         * Labelisation of the base graph that corresponds to the optimal cut with
+         * the given number of regions w.r.t. the aggregated measure.
+         * If the number of regions is equal to 0 (default), the global optimal cut it returned.
+         *
+         * @param num_regions
+         * @return
+         */
+        auto aggregated_optimal_partition(size_t num_regions = 0) const {
+            return fragmentation_curve_internal::optimal_partition_from_backtracking(
+                    m_tree, m_backtracking_aggregated, num_regions);
+        }
+
+    private:
+
+        void assert_ground_truth_index(index_t ground_truth_index) const {
+            hg_assert(ground_truth_index >= 0 && ground_truth_index < (index_t) num_ground_truths(),
+                      "Invalid ground truth index.");
+        }
+
+        std::vector<fragmentation_curve_internal::backtracking_table> m_backtracking;
+        fragmentation_curve_internal::backtracking_table m_backtracking_aggregated;
+        const hg::tree m_tree;
+        std::vector<size_t> m_num_regions_ground_truth;
+        size_t m_num_regions_ground_truth_aggregated;
+    };
+
     template<typename tree_t, typename T1, typename T2, typename scorer_t>
     auto assess_fragmentation_horizontal_cut(
             const tree_t &tree,
@@ -429,4 +714,90 @@ namespace hg {
                                          num_regions_ground_truth};
     };
 
+    /**
+     * Fragmentation curves of the horizontal cuts of a hierarchy w.r.t. several ground truth labelisations of its
+     * base graph and a given partition scorer.
+     *
+     * The horizontal cuts of the hierarchy are computed once and shared between all the ground truths which are
+     * processed in parallel.
+     *
+     * The aggregated fragmentation curve gives, for each horizontal cut, the mean of the scores obtained for each
+     * ground truth. Its number of regions in the ground truth is the rounded mean of the number of regions of all the
+     * ground truths.
+     *
+     * @tparam tree_t tree type
+     * @tparam T1 altitudes type
+     * @tparam T2 type of labels
+     * @tparam scorer_t partition scorer type
+     * @param tree input hierarchy
+     * @param xaltitudes altitudes of the tree nodes
+     * @param xground_truths 2d array of size num_ground_truths x num_base_graph_vertices: each line is a ground truth labelisation of the tree base graph
+     * @param partition_scorer partition scorer (see partition.hpp)
+     * @param vertex_map super-vertices map (if tree is built on a rag, leave empty otherwise)
+     * @param max_regions maximum number of regions in the considered cuts.
+     * @return a pair (vector of fragmentation_curve, one per ground truth, aggregated fragmentation_curve)
+     */
+    template<typename tree_t, typename T1, typename T2, typename scorer_t>
+    auto assess_fragmentation_horizontal_cut_multiple_ground_truths(
+            const tree_t &tree,
+            const xt::xexpression<T1> &xaltitudes,
+            const xt::xexpression<T2> &xground_truths,
+            const scorer_t &partition_scorer,
+            const array_1d<index_t> &vertex_map = {},
+            size_t max_regions = 200) {
+        auto &altitudes = xaltitudes.derived_cast();
+        auto &ground_truths = xground_truths.derived_cast();
+
+        hg_assert_node_weights(tree, altitudes);
+        hg_assert_integral_value_type(ground_truths);
+        hg_assert(ground_truths.dimension() == 2, "Ground truths must be a 2d array.");
+        hg_assert(ground_truths.shape()[0] > 0, "At least one ground truth must be provided.");
+        max_regions = (std::min)(max_regions, num_leaves(tree));
+
+        auto hc_explorer = make_horizontal_cut_explorer(tree, altitudes);
+        auto &num_regions_cuts = hc_explorer.num_regions_cuts();
+        auto last_cut = std::upper_bound(num_regions_cuts.begin(), num_regions_cuts.end(), (index_t)max_regions);
+
+        index_t num_cuts = std::distance(num_regions_cuts.begin(), last_cut);
+
+        array_1d<index_t> num_regions = xt::empty<index_t>({num_cuts});
+        std::copy(num_regions_cuts.begin(), num_regions_cuts.begin() + num_cuts, num_regions.begin());
+
+        std::vector<array_1d<index_t>> cuts_nodes;
+        cuts_nodes.reserve(num_cuts);
+        for (index_t i = 0; i < num_cuts; i++) {
+            cuts_nodes.push_back(std::move(hc_explorer.horizontal_cut_from_index(i).nodes));
+        }
+
+        index_t num_ground_truths = ground_truths.shape()[0];
+        array_2d<double> scores = xt::empty<double>({(size_t) num_ground_truths, (size_t) num_cuts});
+        std::vector<size_t> num_regions_ground_truth(num_ground_truths);
+
+        parfor(0, num_ground_truths, [&](index_t i) {
+            auto card_intersection = fragmentation_curve_internal::compute_card_intersection_tree_ground_truth<double>(
+                    tree, xt::view(ground_truths, i, xt::all()), vertex_map);
+            for (index_t j = 0; j < num_cuts; j++) {
+                scores(i, j) = partition_scorer.score(
+                        xt::view(card_intersection, xt::keep(cuts_nodes[j]), xt::all()));
+            }
+            num_regions_ground_truth[i] = xt::count_nonzero(xt::view(card_intersection, root(tree), xt::all()))();
+        });
+
+        std::vector<hg::fragmentation_curve<>> curves;
+        double mean_num_regions_ground_truth = 0;
+        for (index_t i = 0; i < num_ground_truths; i++) {
+            curves.push_back(hg::fragmentation_curve<>{num_regions,
+                                                       xt::eval(xt::view(scores, i, xt::all())),
+                                                       num_regions_ground_truth[i]});
+            mean_num_regions_ground_truth += (double) num_regions_ground_truth[i];
+        }
+
+        hg::fragmentation_curve<> aggregated_curve{
+                std::move(num_regions),
+                xt::eval(xt::mean(scores, {0})),
+                (size_t) std::round(mean_num_regions_ground_truth / (double) num_ground_truths)};
+
+        return std::make_pair(std::move(curves), std::move(aggregated_curve));
+    };
+
 };
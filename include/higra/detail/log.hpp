@@ -14,6 +14,8 @@
 #include <functional>
 #include <iostream>
 #include <string>
+#include <type_traits>
+#include "profiler.hpp"
 
 namespace hg {
 
@@ -108,19 +110,24 @@ namespace hg {
 #endif
 
 #ifdef HG_ENABLE_TRACE
-#define HG_TRACE() do{                                                  \
+#define HG_TRACE() hg::scoped_timer hg_trace_scoped_timer_(__func__); do{   \
 if(hg::logger::trace_enabled()){                                        \
     HG_LOG_EMIT("TRACE", "function called");                            \
 }                                                                       \
 }while(0)
 
-#define HG_TRACE_INFO(M, ...) do{                                       \
+#define HG_TRACE_INFO(M, ...) hg::scoped_timer hg_trace_scoped_timer_(__func__); do{ \
 if(hg::logger::trace_enabled()){                                        \
     HG_LOG_EMIT("TRACE", "function called " M, ##__VA_ARGS__);          \
 }                                                                       \
 }while(0)
+
+#define HG_TRACE_ALLOCATION(array) hg::profiler::record_allocation( \
+    (array).size() * sizeof(typename std::decay_t<decltype(array)>::value_type))
 #else
 #define HG_TRACE()  do{}while(0)
 
 #define HG_TRACE_INFO(...)  do{}while(0)
+
+#define HG_TRACE_ALLOCATION(...)  do{}while(0)
 #endif
@@ -0,0 +1,276 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2021)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hg {
+
+    /**
+     * Aggregated measures of an instrumented scope
+     */
+    struct profiler_counter {
+        // number of times the scope was entered
+        std::int64_t calls = 0;
+        // total wall time spent in the scope (seconds)
+        double time = 0;
+        // number of bytes allocated for results produced in the scope
+        std::int64_t allocated_bytes = 0;
+    };
+
+    /**
+     * A single execution of an instrumented scope
+     */
+    struct profiler_event {
+        const char *name;
+        std::int64_t start; // nanoseconds since profiler epoch
+        std::int64_t duration; // nanoseconds
+        std::size_t thread;
+    };
+
+    namespace profiler_internal {
+
+        using clock = std::chrono::steady_clock;
+
+        /**
+         * Measures recorded by a single thread.
+         *
+         * Each thread only writes in its own data, the mutex is only contended when a snapshot or a reset happens.
+         */
+        struct thread_data {
+            std::mutex mutex;
+            std::unordered_map<const char *, profiler_counter> counters;
+            std::vector<profiler_event> events;
+            std::vector<profiler_counter *> scopes;
+            std::size_t thread_index;
+        };
+
+        struct registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<thread_data>> threads;
+            clock::time_point epoch = clock::now();
+        };
+
+        inline registry &get_registry() {
+            static registry r;
+            return r;
+        }
+
+        inline std::string json_escape(const std::string &s) {
+            std::string res;
+            for (auto c: s) {
+                switch (c) {
+                    case '"':
+                        res += "\\\"";
+                        break;
+                    case '\\':
+                        res += "\\\\";
+                        break;
+                    case '\n':
+                        res += "\\n";
+                        break;
+                    default:
+                        res += c;
+                }
+            }
+            return res;
+        }
+    }
+
+    /**
+     * Process wide profiler fed by the scoped timers placed by HG_TRACE.
+     *
+     * Measures are aggregated per thread and per instrumented scope (identified by its function name).
+     * Nothing is recorded unless the profiler is enabled at runtime, and HG_TRACE does not create any timer if
+     * HG_ENABLE_TRACE is not defined.
+     */
+    struct profiler {
+
+        static std::atomic<bool> &enabled() {
+            static std::atomic<bool> value{false};
+            return value;
+        }
+
+        /**
+         * If true, each execution of an instrumented scope is also recorded as an event (see chrome_trace_json).
+         */
+        static std::atomic<bool> &events_enabled() {
+            static std::atomic<bool> value{false};
+            return value;
+        }
+
+        /**
+         * Measures of the calling thread
+         */
+        static profiler_internal::thread_data &local_data() {
+            thread_local std::shared_ptr<profiler_internal::thread_data> data = []() {
+                auto &r = profiler_internal::get_registry();
+                auto d = std::make_shared<profiler_internal::thread_data>();
+                std::lock_guard<std::mutex> lock(r.mutex);
+                d->thread_index = r.threads.size();
+                r.threads.push_back(d);
+                return d;
+            }();
+            return *data;
+        }
+
+        static std::int64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    profiler_internal::clock::now() - profiler_internal::get_registry().epoch).count();
+        }
+
+        /**
+         * Attribute the given number of bytes to the innermost active instrumented scope of the calling thread
+         */
+        static void record_allocation(std::size_t bytes) {
+            if (!enabled()) {
+                return;
+            }
+            auto &data = local_data();
+            if (!data.scopes.empty()) {
+                std::lock_guard<std::mutex> lock(data.mutex);
+                data.scopes.back()->allocated_bytes += bytes;
+            }
+        }
+
+        /**
+         * Measures aggregated over all threads, indexed by scope name
+         */
+        static std::map<std::string, profiler_counter> snapshot() {
+            std::map<std::string, profiler_counter> res;
+            auto &r = profiler_internal::get_registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            for (auto &t: r.threads) {
+                std::lock_guard<std::mutex> lock_thread(t->mutex);
+                for (auto &c: t->counters) {
+                    auto &a = res[c.first];
+                    a.calls += c.second.calls;
+                    a.time += c.second.time;
+                    a.allocated_bytes += c.second.allocated_bytes;
+                }
+            }
+            return res;
+        }
+
+        /**
+         * All the recorded events
+         */
+        static std::vector<profiler_event> events() {
+            std::vector<profiler_event> res;
+            auto &r = profiler_internal::get_registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            for (auto &t: r.threads) {
+                std::lock_guard<std::mutex> lock_thread(t->mutex);
+                res.insert(res.end(), t->events.begin(), t->events.end());
+            }
+            return res;
+        }
+
+        /**
+         * Clear all measures and events. Scopes active at the time of the reset are still measured when they exit.
+         */
+        static void reset() {
+            auto &r = profiler_internal::get_registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            for (auto &t: r.threads) {
+                std::lock_guard<std::mutex> lock_thread(t->mutex);
+                for (auto &c: t->counters) {
+                    c.second = profiler_counter();
+                }
+                t->events.clear();
+            }
+        }
+
+        /**
+         * Recorded events in the Chrome trace event format (complete events, timestamps in microseconds) that can be
+         * loaded in chrome://tracing or Perfetto.
+         */
+        static std::string chrome_trace_json() {
+            std::ostringstream out;
+            out << "{\"traceEvents\":[";
+            bool first = true;
+            for (auto &e: events()) {
+                if (!first) {
+                    out << ",";
+                }
+                first = false;
+                out << "{\"name\":\"" << profiler_internal::json_escape(e.name)
+                    << "\",\"cat\":\"higra\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread
+                    << ",\"ts\":" << e.start / 1000.0
+                    << ",\"dur\":" << e.duration / 1000.0 << "}";
+            }
+            out << "],\"displayTimeUnit\":\"ms\"}";
+            return out.str();
+        }
+
+        static void export_chrome_trace(const std::string &filename) {
+            std::ofstream file(filename);
+            file << chrome_trace_json();
+        }
+    };
+
+    /**
+     * RAII timer measuring the execution of a scope when the profiler is enabled.
+     *
+     * The name must be a string with static storage duration (typically __func__).
+     */
+    class scoped_timer {
+    public:
+
+        explicit scoped_timer(const char *name) {
+            if (!profiler::enabled()) {
+                return;
+            }
+            m_data = &profiler::local_data();
+            {
+                std::lock_guard<std::mutex> lock(m_data->mutex);
+                m_counter = &m_data->counters[name];
+                m_counter->calls++;
+            }
+            m_data->scopes.push_back(m_counter);
+            m_name = name;
+            m_start = profiler::now();
+        }
+
+        ~scoped_timer() {
+            if (m_data == nullptr) {
+                return;
+            }
+            auto end = profiler::now();
+            m_data->scopes.pop_back();
+            std::lock_guard<std::mutex> lock(m_data->mutex);
+            m_counter->time += (end - m_start) * 1e-9;
+            if (profiler::events_enabled()) {
+                m_data->events.push_back({m_name, m_start, end - m_start, m_data->thread_index});
+            }
+        }
+
+        scoped_timer(const scoped_timer &) = delete;
+
+        scoped_timer &operator=(const scoped_timer &) = delete;
+
+    private:
+        profiler_internal::thread_data *m_data = nullptr;
+        profiler_counter *m_counter = nullptr;
+        const char *m_name = nullptr;
+        std::int64_t m_start = 0;
+    };
+}
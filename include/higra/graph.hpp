@@ -13,6 +13,7 @@
 #include "structure/undirected_graph.hpp"
 #include "structure/regular_graph.hpp"
 #include "structure/tree_graph.hpp"
+#include "structure/csr_graph.hpp"
 
 namespace hg {
 
@@ -143,6 +143,9 @@ namespace hg {
         array_1d<typename T::value_type> levels = xt::zeros<typename T::value_type>({parents.size()});
         xt::noalias(xt::view(levels, xt::range(num_points, levels.size()))) = xt::index_view(edge_weights,
                                                                                              mst_edge_map);
+        HG_TRACE_ALLOCATION(parents);
+        HG_TRACE_ALLOCATION(levels);
+        HG_TRACE_ALLOCATION(mst_edge_map);
 
         return make_node_weighted_tree_and_mst(
                 tree(std::move(parents)),
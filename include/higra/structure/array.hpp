@@ -14,6 +14,9 @@
 #include "xtensor/containers/xtensor.hpp"
 #include "xtensor/generators/xgenerator.hpp"
 #include "xtensor/core/xeval.hpp"
+#include "xtensor/containers/xbuffer_adaptor.hpp"
+#include <memory>
+#include <type_traits>
 
 #include "point.hpp"
 
@@ -36,4 +39,68 @@ namespace hg {
 
     template<typename value_t>
     using array_nd = xt::xarray<value_t>;
+
+    /**
+     * 1d array adapting a contiguous buffer whose lifetime is managed by a shared owner.
+     *
+     * Copies of a shared array share the same buffer (no element is copied) and the owner is released when the last
+     * copy is destroyed. The owner can be anything keeping the buffer alive: an array moved into the shared array,
+     * a numpy array, a memory mapped file...
+     *
+     * A shared array cannot be resized: use the make_shared_array_1d and to_shared_array_1d functions to create one.
+     */
+    template<typename value_t>
+    using shared_array_1d = xt::xtensor_adaptor<xt::xbuffer_adaptor<value_t *, xt::no_ownership, std::shared_ptr<void>>, 1>;
+
+    /**
+     * Shared array borrowing an existing buffer: no copy is performed.
+     *
+     * @param data pointer to the first element of the buffer
+     * @param size number of elements in the buffer
+     * @param owner object keeping the buffer alive
+     */
+    template<typename value_t>
+    shared_array_1d<value_t> make_shared_array_1d(value_t *data, size_t size, std::shared_ptr<void> owner) {
+        using buffer_t = typename shared_array_1d<value_t>::storage_type;
+        return shared_array_1d<value_t>(buffer_t(data, size, std::move(owner)), {size});
+    }
+
+    /**
+     * Shared array with a new uninitialized buffer of the given size.
+     */
+    template<typename value_t>
+    shared_array_1d<value_t> make_shared_array_1d(size_t size = 0) {
+        auto buffer = std::make_shared<array_1d<value_t>>(array_1d<value_t>::from_shape({size}));
+        auto data = buffer->data();
+        return make_shared_array_1d(data, size, std::move(buffer));
+    }
+
+    /**
+     * A shared array is returned as is.
+     */
+    template<typename value_t>
+    shared_array_1d<value_t> to_shared_array_1d(shared_array_1d<value_t> array) {
+        return array;
+    }
+
+    /**
+     * Transfer the ownership of the given 1d container to a new shared array.
+     *
+     * No element is copied if the container is contiguous (its content is moved in the owner of the shared array),
+     * otherwise the elements are copied in a new buffer.
+     *
+     * @param container a 1d container (rvalue)
+     */
+    template<typename container_t,
+            typename = std::enable_if_t<!std::is_lvalue_reference<container_t>::value>>
+    shared_array_1d<typename std::decay_t<container_t>::value_type> to_shared_array_1d(container_t &&container) {
+        using value_type = typename std::decay_t<container_t>::value_type;
+        if (container.size() > 1 && container.strides()[0] != 1) {
+            return to_shared_array_1d(array_1d<value_type>(container));
+        }
+        auto buffer = std::make_shared<std::decay_t<container_t>>(std::move(container));
+        auto data = buffer->data();
+        auto size = buffer->size();
+        return make_shared_array_1d(data, size, std::move(buffer));
+    }
 }
@@ -0,0 +1,329 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2021)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "details/graph_concepts.hpp"
+#include "details/indexed_edge.hpp"
+#include "higra/structure/details/iterators.hpp"
+#include "../utils.hpp"
+#include "array.hpp"
+
+namespace hg {
+
+    namespace csr_graph_internal {
+
+        struct csr_graph_traversal_category :
+                virtual public graph::incidence_graph_tag,
+                virtual public graph::bidirectional_graph_tag,
+                virtual public graph::adjacency_graph_tag,
+                virtual public graph::vertex_list_graph_tag,
+                virtual public graph::edge_list_graph_tag {
+        };
+
+        /**
+         * Static undirected graph whose adjacency lists are stored in the compressed sparse row (CSR) format.
+         *
+         * The graph is defined by two arrays giving the source and the target of each edge. Those arrays are shared
+         * arrays (see shared_array_1d): they can be borrowed from an existing buffer (e.g. a numpy array or a memory
+         * mapped file) without any copy. The adjacency lists are built at construction with a counting sort of
+         * the edges, they use two arrays of size num_vertices + 1 and 2 * num_edges.
+         *
+         * Contrarily to undirected_graph, edges are not reordered (the source of an edge may be larger than its
+         * target) and the graph cannot be modified.
+         */
+        struct csr_graph {
+
+            // Graph associated types
+            using vertex_descriptor = index_t;
+            using edge_index_t = index_t;
+            using edge_descriptor = indexed_edge<vertex_descriptor, edge_index_t>;
+            using directed_category = graph::undirected_tag;
+            using edge_parallel_category = graph::allow_parallel_edge_tag;
+            using traversal_category = csr_graph_traversal_category;
+
+            // VertexListGraph associated types
+            using vertex_iterator = counting_iterator<vertex_descriptor>;
+            using vertices_size_type = size_t;
+
+            // custom edge index iterators
+            using out_edge_index_iterator = const edge_index_t *;
+            using in_edge_index_iterator = out_edge_index_iterator;
+
+            // EdgeListGraph associated types
+            using edges_size_type = size_t;
+            using edge_iterator = transform_forward_iterator<std::function<edge_descriptor(edge_index_t)>,
+                    counting_iterator<edge_index_t>,
+                    edge_descriptor>;
+
+            // IncidenceGraph associated types
+            using out_iterator_transform_function = std::function<edge_descriptor(edge_index_t)>;
+            using out_edge_iterator = transform_forward_iterator<out_iterator_transform_function,
+                    out_edge_index_iterator,
+                    edge_descriptor>;
+            using degree_size_type = size_t;
+
+            //BidirectionalGraph associated types
+            using in_edge_iterator = out_edge_iterator;
+
+            //AdjacencyGraph associated types
+            using adjacent_iterator_transform_function = std::function<vertex_descriptor(edge_index_t)>;
+            using adjacency_iterator = transform_forward_iterator<adjacent_iterator_transform_function,
+                    out_edge_index_iterator,
+                    vertex_descriptor>;
+
+            csr_graph(size_t num_vertices = 0) :
+                    csr_graph(num_vertices, make_shared_array_1d<vertex_descriptor>(),
+                              make_shared_array_1d<vertex_descriptor>()) {
+            }
+
+            /**
+             * Creates a graph on the given shared arrays of sources and targets: no copy is performed.
+             *
+             * The arrays must not be modified during the lifetime of the graph (and of its copies).
+             *
+             * @param num_vertices number of vertices of the graph
+             * @param sources source vertex of each edge
+             * @param targets target vertex of each edge
+             */
+            csr_graph(size_t num_vertices,
+                      shared_array_1d<vertex_descriptor> sources,
+                      shared_array_1d<vertex_descriptor> targets) :
+                    m_num_vertices(num_vertices),
+                    m_sources(std::move(sources)),
+                    m_targets(std::move(targets)),
+                    m_out_edge_offsets(make_shared_array_1d<edge_index_t>(num_vertices + 1)),
+                    m_out_edges(make_shared_array_1d<edge_index_t>(0)) {
+                HG_TRACE();
+                hg_assert_same_shape(m_sources, m_targets);
+                _init();
+            }
+
+            /**
+             * Creates a graph from the given arrays of sources and targets (the arrays are copied).
+             *
+             * @param num_vertices number of vertices of the graph
+             * @param sources source vertex of each edge
+             * @param targets target vertex of each edge
+             */
+            template<typename T1, typename T2>
+            csr_graph(size_t num_vertices,
+                      const xt::xexpression<T1> &sources,
+                      const xt::xexpression<T2> &targets) :
+                    csr_graph(num_vertices,
+                              to_shared_array_1d(array_1d<vertex_descriptor>(sources)),
+                              to_shared_array_1d(array_1d<vertex_descriptor>(targets))) {
+            }
+
+            vertices_size_type num_vertices() const {
+                return m_num_vertices;
+            }
+
+            edges_size_type num_edges() const {
+                return m_sources.size();
+            }
+
+            degree_size_type degree(vertex_descriptor v) const {
+                return m_out_edge_offsets(v + 1) - m_out_edge_offsets(v);
+            }
+
+            edge_descriptor edge_from_index(edge_index_t ei) const {
+                return edge_descriptor(m_sources(ei), m_targets(ei), ei);
+            }
+
+            out_edge_index_iterator out_edges_cbegin(vertex_descriptor v) const {
+                return m_out_edges.data() + m_out_edge_offsets(v);
+            }
+
+            out_edge_index_iterator out_edges_cend(vertex_descriptor v) const {
+                return m_out_edges.data() + m_out_edge_offsets(v + 1);
+            }
+
+            const auto &sources() const {
+                return m_sources;
+            }
+
+            const auto &targets() const {
+                return m_targets;
+            }
+
+            /**
+             * Offsets of the adjacency lists: the indices of the edges incident to the vertex v are
+             * out_edge_indices()[out_edge_offsets()[v]:out_edge_offsets()[v + 1]]
+             */
+            const auto &out_edge_offsets() const {
+                return m_out_edge_offsets;
+            }
+
+            const auto &out_edge_indices() const {
+                return m_out_edges;
+            }
+
+        private:
+
+            void _init() {
+                auto num_edges = (index_t) m_sources.size();
+                auto &offsets = m_out_edge_offsets;
+                std::fill(offsets.begin(), offsets.end(), 0);
+                for (index_t i = 0; i < num_edges; i++) {
+                    auto s = m_sources(i);
+                    auto t = m_targets(i);
+                    hg_assert(s >= 0 && s < (index_t) m_num_vertices && t >= 0 && t < (index_t) m_num_vertices,
+                              "Invalid vertex index.");
+                    offsets(s + 1)++;
+                    if (s != t) {
+                        offsets(t + 1)++;
+                    }
+                }
+                for (index_t v = 0; v < (index_t) m_num_vertices; v++) {
+                    offsets(v + 1) += offsets(v);
+                }
+
+                // counting sort of the edges by incident vertex, edges incident to a vertex are sorted by index
+                m_out_edges = make_shared_array_1d<edge_index_t>(offsets(m_num_vertices));
+                std::vector<index_t> position(offsets.begin(), offsets.end() - 1);
+                for (index_t i = 0; i < num_edges; i++) {
+                    auto s = m_sources(i);
+                    auto t = m_targets(i);
+                    m_out_edges(position[s]++) = i;
+                    if (s != t) {
+                        m_out_edges(position[t]++) = i;
+                    }
+                }
+            }
+
+            size_t m_num_vertices;
+            shared_array_1d<vertex_descriptor> m_sources;
+            shared_array_1d<vertex_descriptor> m_targets;
+            shared_array_1d<edge_index_t> m_out_edge_offsets;
+            shared_array_1d<edge_index_t> m_out_edges;
+        };
+    }
+
+    using csr_graph = csr_graph_internal::csr_graph;
+
+    namespace graph {
+        template<>
+        struct graph_traits<hg::csr_graph> {
+            using G = hg::csr_graph;
+
+            using vertex_descriptor = typename G::vertex_descriptor;
+            using edge_descriptor = typename G::edge_descriptor;
+            using edge_iterator = typename G::edge_iterator;
+            using out_edge_iterator = typename G::out_edge_iterator;
+
+            using directed_category = typename G::directed_category;
+            using edge_parallel_category = typename G::edge_parallel_category;
+            using traversal_category = typename G::traversal_category;
+
+            using degree_size_type = typename G::degree_size_type;
+
+            using in_edge_iterator = typename G::in_edge_iterator;
+            using vertex_iterator = typename G::vertex_iterator;
+            using vertices_size_type = typename G::vertices_size_type;
+            using edges_size_type = typename G::edges_size_type;
+            using adjacency_iterator = typename G::adjacency_iterator;
+
+            using edge_index = typename G::edge_index_t;
+        };
+    }
+
+    inline
+    hg::csr_graph::edge_descriptor edge_from_index(const hg::csr_graph::edge_index_t ei, const hg::csr_graph &g) {
+        return g.edge_from_index(ei);
+    }
+
+    inline
+    hg::csr_graph::vertices_size_type num_vertices(const hg::csr_graph &g) {
+        return g.num_vertices();
+    }
+
+    inline
+    hg::csr_graph::edges_size_type num_edges(const hg::csr_graph &g) {
+        return g.num_edges();
+    }
+
+    inline
+    hg::csr_graph::degree_size_type degree(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        return g.degree(v);
+    }
+
+    inline
+    hg::csr_graph::degree_size_type in_degree(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        return g.degree(v);
+    }
+
+    inline
+    hg::csr_graph::degree_size_type out_degree(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        return g.degree(v);
+    }
+
+    inline
+    std::pair<hg::csr_graph::vertex_iterator, hg::csr_graph::vertex_iterator>
+    vertices(const hg::csr_graph &g) {
+        using vertex_iterator = hg::csr_graph::vertex_iterator;
+        return std::make_pair(
+                vertex_iterator(0),                 // The first iterator position
+                vertex_iterator(num_vertices(g))); // The last iterator position
+    }
+
+    inline
+    std::pair<hg::csr_graph::edge_iterator, hg::csr_graph::edge_iterator>
+    edges(const hg::csr_graph &g) {
+        using it = hg::csr_graph::edge_iterator;
+        auto fun = [&g](hg::csr_graph::edge_index_t i) {
+            return g.edge_from_index(i);
+        };
+        return std::make_pair(
+                it(counting_iterator<hg::csr_graph::edge_index_t>(0), fun),                 // The first iterator position
+                it(counting_iterator<hg::csr_graph::edge_index_t>(g.num_edges()), fun)); // The last iterator position
+    }
+
+    inline
+    std::pair<hg::csr_graph::out_edge_iterator, hg::csr_graph::out_edge_iterator>
+    out_edges(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        auto fun = [v, &g](const hg::csr_graph::edge_index_t oei) {
+            auto oe = g.edge_from_index(oei);
+            return hg::csr_graph::edge_descriptor(v, (v == oe.source) ? oe.target : oe.source, oe.index);
+        };
+        using it = hg::csr_graph::out_edge_iterator;
+        return std::make_pair(
+                it(g.out_edges_cbegin(v), fun),
+                it(g.out_edges_cend(v), fun));
+    }
+
+    inline
+    std::pair<hg::csr_graph::in_edge_iterator, hg::csr_graph::in_edge_iterator>
+    in_edges(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        auto fun = [v, &g](const hg::csr_graph::edge_index_t oei) {
+            auto oe = g.edge_from_index(oei);
+            return hg::csr_graph::edge_descriptor((v == oe.source) ? oe.target : oe.source, v, oe.index);
+        };
+        using it = hg::csr_graph::in_edge_iterator;
+        return std::make_pair(
+                it(g.out_edges_cbegin(v), fun),
+                it(g.out_edges_cend(v), fun));
+    }
+
+    inline
+    std::pair<hg::csr_graph::adjacency_iterator, hg::csr_graph::adjacency_iterator>
+    adjacent_vertices(const hg::csr_graph::vertex_descriptor v, const hg::csr_graph &g) {
+        auto fun = [v, &g](const hg::csr_graph::edge_index_t oei) {
+            auto s = g.sources()(oei);
+            return (v == s) ? g.targets()(oei) : s;
+        };
+        using it = hg::csr_graph::adjacency_iterator;
+        return std::make_pair(
+                it(g.out_edges_cbegin(v), fun),
+                it(g.out_edges_cend(v), fun));
+    }
+}
@@ -69,21 +69,21 @@ namespace hg {
             rmq_sparse_table(const T &values) : m_data(values.data()) {
                 index_t size = values.size();
                 reserve_sparse_table(size);
-                m_sparse_table.push_back(xt::arange<size_t>(0, size));
+                m_sparse_table.push_back(to_shared_array_1d(array_1d<size_t>(xt::arange<size_t>(0, size))));
                 init_sparse_table();
             }
 
             template<typename T>
             rmq_sparse_table(const T &values, array_1d <size_t> &&element_map) : m_data(values.data()) {
                 reserve_sparse_table(element_map.size());
-                m_sparse_table.push_back(std::move(element_map));
+                m_sparse_table.push_back(to_shared_array_1d(std::move(element_map)));
                 init_sparse_table();
             }
 
             template<typename T>
             rmq_sparse_table(const T &values, const array_1d <size_t> &element_map) : m_data(values.data()) {
                 reserve_sparse_table(element_map.size());
-                m_sparse_table.push_back(element_map);
+                m_sparse_table.push_back(to_shared_array_1d(array_1d<size_t>(element_map)));
                 init_sparse_table();
             }
 
@@ -114,8 +114,11 @@ namespace hg {
                         sparse_table(std::move(_sparse_table)) {}
             };
 
+            /**
+             * The returned state shares its arrays with this object
+             */
             auto get_state() const {
-                return internal_state<array_1d>(m_sparse_table);
+                return internal_state<shared_array_1d>(m_sparse_table);
             }
 
             template<template<typename> typename container_t, typename T>
@@ -138,18 +141,18 @@ namespace hg {
             void set_state(internal_state<container_t> &&state, const T &data) {
                 m_sparse_table.clear();
                 for(auto & e: state.sparse_table){
-                    m_sparse_table.push_back(std::move(e));
+                    m_sparse_table.push_back(to_shared_array_1d(std::move(e)));
                 }
-                m_data = data.begin();
+                m_data = data.data();
             }
 
             template<template<typename> typename container_t, typename T>
             void set_state(const internal_state<container_t> &state, const T &data) {
                 m_sparse_table.clear();
                 for(auto & e: state.sparse_table){
-                    m_sparse_table.push_back(e);
+                    m_sparse_table.push_back(to_shared_array_1d(std::decay_t<decltype(e)>(e)));
                 }
-                m_data = data.begin();
+                m_data = data.data();
             }
 
 
@@ -180,7 +183,7 @@ namespace hg {
 
                 for (index_t lvl = 0; (2 << lvl) <= size; lvl++) {
                     index_t size_lvlp1 = size - (2 << lvl) + 1;
-                    m_sparse_table.push_back(array_1d<index_t>::from_shape({(size_t) size_lvlp1}));
+                    m_sparse_table.push_back(make_shared_array_1d<size_t>((size_t) size_lvlp1));
                     parfor(0, size_lvlp1, [this, lvl](index_t i) {
                         auto p1 = m_sparse_table[lvl](i);
                         auto p2 = m_sparse_table[lvl](i + ((size_t)1 << lvl));
@@ -189,7 +192,8 @@ namespace hg {
                 }
             }
 
-            std::vector<array_1d < size_t>> m_sparse_table;
+            // arrays are shared with the copies of the object and may be borrowed from an external buffer
+            std::vector<shared_array_1d<size_t>> m_sparse_table;
             const data_t *m_data;
         };
 
@@ -214,8 +218,8 @@ namespace hg {
                 hg_assert(block_size > 0, "Block size must be strictly positive");
                 m_data_size = values.size();
                 m_num_blocks = (m_data_size + m_block_size - 1) / m_block_size;
-                m_block_minimum_prefix.resize({(size_t) (m_num_blocks * m_block_size)});
-                m_block_minimum_suffix.resize({(size_t) (m_num_blocks * m_block_size)});
+                m_block_minimum_prefix = make_shared_array_1d<index_t>((size_t) (m_num_blocks * m_block_size));
+                m_block_minimum_suffix = make_shared_array_1d<index_t>((size_t) (m_num_blocks * m_block_size));
                 init(values);
             }
 
@@ -290,8 +294,11 @@ namespace hg {
                         sparse_table(_sp_state) {}
             };
 
+            /**
+             * The returned state shares its arrays with this object
+             */
             auto get_state() const {
-                return internal_state<array_1d>(m_data_size,
+                return internal_state<shared_array_1d>(m_data_size,
                         m_block_size,
                         m_num_blocks,
                         m_block_minimum_prefix,
@@ -320,11 +327,11 @@ namespace hg {
                 m_data_size = state.data_size;
                 m_block_size = state.block_size;
                 m_num_blocks = state.num_blocks;
-                m_block_minimum_prefix = std::move(state.block_minimum_prefix);
-                m_block_minimum_suffix = std::move(state.block_minimum_suffix);
+                m_block_minimum_prefix = to_shared_array_1d(std::move(state.block_minimum_prefix));
+                m_block_minimum_suffix = to_shared_array_1d(std::move(state.block_minimum_suffix));
                 m_sparse_table = rmq_sparse_table<typename T::value_type>::make_from_state(
                         std::move(state.sparse_table), data);
-                m_data = data.begin();
+                m_data = data.data();
             }
 
             template<template<typename> typename container_t, typename T>
@@ -332,10 +339,10 @@ namespace hg {
                 m_data_size = state.data_size;
                 m_block_size = state.block_size;
                 m_num_blocks = state.num_blocks;
-                m_block_minimum_prefix = state.block_minimum_prefix;
-                m_block_minimum_suffix = state.block_minimum_suffix;
+                m_block_minimum_prefix = to_shared_array_1d(container_t<index_t>(state.block_minimum_prefix));
+                m_block_minimum_suffix = to_shared_array_1d(container_t<index_t>(state.block_minimum_suffix));
                 m_sparse_table = rmq_sparse_table<typename T::value_type>::make_from_state(state.sparse_table, data);
-                m_data = data.begin();
+                m_data = data.data();
             }
 
             template<typename T>
@@ -386,8 +393,8 @@ namespace hg {
             index_t m_data_size;
             index_t m_block_size;
             index_t m_num_blocks;
-            array_1d <index_t> m_block_minimum_prefix;
-            array_1d <index_t> m_block_minimum_suffix;
+            shared_array_1d<index_t> m_block_minimum_prefix = make_shared_array_1d<index_t>();
+            shared_array_1d<index_t> m_block_minimum_suffix = make_shared_array_1d<index_t>();
             rmq_sparse_table<index_t> m_sparse_table;
 
         };
@@ -42,9 +42,9 @@ namespace hg {
                 auto num_nodes = hg::num_vertices(tree);
                 auto num_elements_Euler_tour = 2 * num_nodes - 1;
 
-                m_first_visit_in_Euler_tour.resize({num_nodes});
-                m_tree_Euler_tour_map.resize({num_elements_Euler_tour});
-                m_tree_Euler_tour_depth.resize({num_elements_Euler_tour});
+                m_first_visit_in_Euler_tour = make_shared_array_1d<index_t>(num_nodes);
+                m_tree_Euler_tour_map = make_shared_array_1d<index_t>(num_elements_Euler_tour);
+                m_tree_Euler_tour_depth = make_shared_array_1d<index_t>(num_elements_Euler_tour);
 
                 compute_Euler_tour(tree);
                 m_rmq_solver = rmq_t(m_tree_Euler_tour_depth, std::forward<Args>(args)...);
@@ -146,8 +146,11 @@ namespace hg {
                         rmq_state(std::move(_rmq_state)) {}
             };
 
+            /**
+             * The returned state shares its arrays with this object
+             */
             auto get_state() const {
-                return internal_state<array_1d>(m_tree_Euler_tour_map,
+                return internal_state<shared_array_1d>(m_tree_Euler_tour_map,
                                                 m_tree_Euler_tour_depth,
                                                 m_first_visit_in_Euler_tour,
                                                 m_rmq_solver.get_state());
@@ -179,26 +182,29 @@ namespace hg {
 
             template<template<typename> typename container_t>
             void set_state(internal_state<container_t> &&state) {
-                m_tree_Euler_tour_map = std::move(state.tree_Euler_tour_map);
-                m_tree_Euler_tour_depth = std::move(state.tree_Euler_tour_depth);
-                m_first_visit_in_Euler_tour = std::move(state.first_visit_in_Euler_tour);
+                m_tree_Euler_tour_map = to_shared_array_1d(std::move(state.tree_Euler_tour_map));
+                m_tree_Euler_tour_depth = to_shared_array_1d(std::move(state.tree_Euler_tour_depth));
+                m_first_visit_in_Euler_tour = to_shared_array_1d(std::move(state.first_visit_in_Euler_tour));
                 m_rmq_solver = rmq_t::make_from_state(std::move(state.rmq_state), m_tree_Euler_tour_depth);
             }
 
             template<template<typename> typename container_t>
             void set_state(const internal_state<container_t> &state) {
-                m_tree_Euler_tour_map = state.tree_Euler_tour_map;
-                m_tree_Euler_tour_depth = state.tree_Euler_tour_depth;
-                m_first_visit_in_Euler_tour = state.first_visit_in_Euler_tour;
+                m_tree_Euler_tour_map = to_shared_array_1d(container_t<index_t>(state.tree_Euler_tour_map));
+                m_tree_Euler_tour_depth = to_shared_array_1d(container_t<index_t>(state.tree_Euler_tour_depth));
+                m_first_visit_in_Euler_tour = to_shared_array_1d(container_t<index_t>(state.first_visit_in_Euler_tour));
                 m_rmq_solver = rmq_t::make_from_state(state.rmq_state, m_tree_Euler_tour_depth);
             }
 
+            // arrays are shared with the copies of the object and may be borrowed from an external buffer (see
+            // make_from_state)
+
             // tree node index visited at each step of the Euler tour
-            array_1d<index_t> m_tree_Euler_tour_map;
+            shared_array_1d<index_t> m_tree_Euler_tour_map = make_shared_array_1d<index_t>();
             // depth of the tree node visited at each step of the Euler tour
-            array_1d<index_t> m_tree_Euler_tour_depth;
+            shared_array_1d<index_t> m_tree_Euler_tour_depth = make_shared_array_1d<index_t>();
             // index of the first time a node of the tree is visited in the Euler tour
-            array_1d<index_t> m_first_visit_in_Euler_tour;
+            shared_array_1d<index_t> m_first_visit_in_Euler_tour = make_shared_array_1d<index_t>();
 
             // rmq solver
             rmq_t m_rmq_solver;
@@ -0,0 +1,140 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2020)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <functional>
+#include "../utils.hpp"
+
+namespace hg {
+
+    /**
+     * A forest of mergeable leftist heaps stored in flat arrays.
+     *
+     * Each element of the forest is identified by an index in [0, capacity[ chosen by the user. A heap is identified
+     * by the index of its root element, an empty heap is represented by invalid_index. Elements only store a key,
+     * the element index can be used by the user to retrieve any associated data.
+     *
+     * All operations (push, pop, merge) run in O(log(n)) and never allocate memory.
+     *
+     * @tparam key_type type of the keys
+     * @tparam compare_type strict weak ordering on keys: the top of a heap is the smallest element for this order
+     */
+    template<typename key_type, typename compare_type = std::less<key_type>>
+    class leftist_heap_forest {
+    public:
+
+        /**
+         * @param capacity number of elements of the forest
+         * @param compare comparison function
+         */
+        leftist_heap_forest(size_t capacity, compare_type compare = compare_type()) :
+                m_keys(capacity),
+                m_left(capacity),
+                m_right(capacity),
+                m_rank(capacity),
+                m_compare(compare) {
+        }
+
+        size_t capacity() const {
+            return m_keys.size();
+        }
+
+        /**
+         * Create a heap containing a single element
+         *
+         * @param element index of the element
+         * @param key key of the element
+         * @return the new heap
+         */
+        index_t make_heap(index_t element, const key_type &key) {
+            m_keys[element] = key;
+            m_left[element] = invalid_index;
+            m_right[element] = invalid_index;
+            m_rank[element] = 1;
+            return element;
+        }
+
+        /**
+         * Insert a new element in the given heap
+         *
+         * @param heap a heap (may be empty)
+         * @param element index of the new element
+         * @param key key of the new element
+         * @return the resulting heap
+         */
+        index_t push(index_t heap, index_t element, const key_type &key) {
+            return merge(heap, make_heap(element, key));
+        }
+
+        /**
+         * Merge two heaps. The input heaps are consumed.
+         *
+         * @return the resulting heap
+         */
+        index_t merge(index_t heap1, index_t heap2) {
+            if (heap1 == invalid_index) {
+                return heap2;
+            }
+            if (heap2 == invalid_index) {
+                return heap1;
+            }
+            if (m_compare(m_keys[heap2], m_keys[heap1])) {
+                std::swap(heap1, heap2);
+            }
+            m_right[heap1] = merge(m_right[heap1], heap2);
+            if (rank(m_left[heap1]) < rank(m_right[heap1])) {
+                std::swap(m_left[heap1], m_right[heap1]);
+            }
+            m_rank[heap1] = rank(m_right[heap1]) + 1;
+            return heap1;
+        }
+
+        /**
+         * Remove the top element of the given non empty heap
+         *
+         * @return the resulting heap
+         */
+        index_t pop(index_t heap) {
+            return merge(m_left[heap], m_right[heap]);
+        }
+
+        /**
+         * Index of the top element of the given non empty heap
+         */
+        index_t top(index_t heap) const {
+            return heap;
+        }
+
+        /**
+         * Key of the given element
+         */
+        const key_type &key(index_t element) const {
+            return m_keys[element];
+        }
+
+        static bool empty(index_t heap) {
+            return heap == invalid_index;
+        }
+
+    private:
+
+        index_t rank(index_t heap) const {
+            return (heap == invalid_index) ? 0 : m_rank[heap];
+        }
+
+        std::vector<key_type> m_keys;
+        std::vector<index_t> m_left;
+        std::vector<index_t> m_right;
+        std::vector<index_t> m_rank;
+        compare_type m_compare;
+    };
+}
@@ -16,6 +16,7 @@
 #include "higra/structure/details/iterators.hpp"
 #include <vector>
 #include <utility>
+#include <memory>
 #include "../utils.hpp"
 #include "array.hpp"
 
@@ -104,14 +105,20 @@ namespace hg {
             //BidirectionalGraph associated types
             using in_edge_iterator = out_edge_iterator;
 
-            tree() : _root(invalid_index), _num_vertices(0), _num_leaves(0), _children_computed(false), _category(tree_category::partition_tree){
+            // parents array: the buffer is shared between the copies of the tree, it is either owned by the tree
+            // or borrowed from an external owner (e.g. a numpy array or a memory mapped file)
+            using parents_type = shared_array_1d<vertex_descriptor>;
+
+            tree() : _root(invalid_index), _num_vertices(0), _num_leaves(0),
+                     _parents(make_shared_array_1d<vertex_descriptor>()),
+                     _children_computed(false), _category(tree_category::partition_tree){
 
             }
 
             template<typename T>
             tree(const xt::xexpression<T> &parents = xt::xarray<vertex_descriptor>({0}),
                  tree_category category = tree_category::partition_tree) :
-                    _parents(parents),
+                    _parents(to_shared_array_1d(array_1d<vertex_descriptor>(parents))),
                     _children_computed(false),
                     _children(0),
                     _category(category) {
@@ -122,7 +129,7 @@ namespace hg {
             template<typename T>
             tree(xt::xexpression<T> &&parents = xt::xarray<vertex_descriptor>({0}),
                  tree_category category = tree_category::partition_tree) :
-                    _parents(std::move(parents.derived_cast())),
+                    _parents(to_shared_array_1d(array_1d<vertex_descriptor>(std::move(parents.derived_cast())))),
                     _children_computed(false),
                     _children(0),
                     _category(category) {
@@ -130,6 +137,49 @@ namespace hg {
                 _init();
             };
 
+            /**
+             * Creates a tree on the buffer of the given shared array: no copy is performed.
+             *
+             * The buffer must not be modified during the lifetime of the tree (and of its copies).
+             *
+             * @param parents parents array
+             * @param category tree category
+             * @param check if false, the parents array is assumed to be a valid tree: only the number of leaves
+             * is computed
+             */
+            tree(parents_type parents,
+                 tree_category category = tree_category::partition_tree,
+                 bool check = true) :
+                    _parents(std::move(parents)),
+                    _children_computed(false),
+                    _children(0),
+                    _category(category) {
+                HG_TRACE();
+                _init(check);
+            };
+
+            /**
+             * Creates a tree whose parents array is an existing buffer: no copy is performed.
+             *
+             * The buffer must not be modified during the lifetime of the tree (and of its copies).
+             *
+             * @param parents pointer to the first element of the parents array
+             * @param num_vertices number of elements in the parents array
+             * @param owner any object keeping the buffer alive (released when the last copy of the tree is destroyed)
+             * @param category tree category
+             * @param check if false, the parents array is assumed to be a valid tree: only the number of leaves
+             * is computed
+             */
+            tree(const vertex_descriptor *parents,
+                 size_t num_vertices,
+                 std::shared_ptr<void> owner,
+                 tree_category category = tree_category::partition_tree,
+                 bool check = true) :
+                    tree(make_shared_array_1d(const_cast<vertex_descriptor *>(parents), num_vertices, std::move(owner)),
+                         category,
+                         check) {
+            };
+
             const auto &category() const {
                 return _category;
             }
@@ -185,6 +235,12 @@ namespace hg {
                 return _parents(std::forward<Args>(args)...);
             }
 
+            /**
+             * Parents array of the tree.
+             *
+             * This is a view on the buffer shared by all the copies of the tree (see shared_array_1d),
+             * use array_1d<index_t>(t.parents()) to obtain an independent copy.
+             */
             const auto &parents() const {
                 return _parents;
             }
@@ -254,7 +310,7 @@ namespace hg {
 
         private:
 
-            void _init() {
+            void _init(bool check = true) {
                 if (_parents.size() == 0) {
                     _root = invalid_index;
                     _num_vertices = 0;
@@ -266,7 +322,20 @@ namespace hg {
                 _root = _num_vertices - 1;
                 hg_assert(_parents(_root) == _root, "nodes are not in a topological order (last node is not a root)");
 
-                array_1d<index_t> num_children = xt::zeros_like(_parents);
+                if (check) {
+                    _validate();
+                } else {
+                    // in a valid tree, the first non leaf node is the smallest parent
+                    vertex_descriptor num_leaves = _root;
+                    for (vertex_descriptor v = 0; v < _root; ++v) {
+                        num_leaves = (std::min)(num_leaves, _parents(v));
+                    }
+                    _num_leaves = (_num_vertices == 1) ? 1 : num_leaves;
+                }
+            }
+
+            void _validate() {
+                array_1d<index_t> num_children = xt::zeros<index_t>({_num_vertices});
                 for (vertex_descriptor v = 0; v < _root; ++v) {
                     vertex_descriptor parent_v = _parents(v);
                     hg_assert(parent_v != v, "several root nodes detected");
@@ -289,7 +358,7 @@ namespace hg {
             vertex_descriptor _root;
             size_t _num_vertices;
             index_t _num_leaves;
-            array_1d <vertex_descriptor> _parents;
+            parents_type _parents;
             mutable bool _children_computed;
             mutable std::vector<children_list_t> _children;
             tree_category _category;
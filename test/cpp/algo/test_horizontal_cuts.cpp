@@ -243,5 +243,92 @@ namespace test_horizontal_cuts {
         array_1d<int> ref_cut{0, 0, 0, 0, 0, 1, 0, 0, 1, 0};
         REQUIRE((cut == ref_cut));
     }
+
+    TEST_CASE("horizontal cut incremental labelisation", "[horizontal_cuts]") {
+
+        hg::tree tree{
+                array_1d<index_t>{11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18}
+        };
+        array_1d<int> altitudes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3};
+        auto hch = make_horizontal_cut_explorer(tree, altitudes);
+
+        auto lab = hch.incremental_labelisation();
+        REQUIRE(lab.cut_index() == 0);
+        REQUIRE(!lab.previous_cut());
+        for (index_t i = 0; i < (index_t) hch.num_cuts(); i++) {
+            REQUIRE(lab.cut_index() == i);
+            REQUIRE(lab.num_regions() == hch.num_regions_cut(i));
+            REQUIRE(lab.altitude() == hch.altitude_cut(i));
+            REQUIRE((lab.labelisation_leaves() == hch.horizontal_cut_from_index(i).labelisation_leaves(tree)));
+            REQUIRE(lab.next_cut() == (i + 1 < (index_t) hch.num_cuts()));
+        }
+
+        for (index_t i = (index_t) hch.num_cuts() - 1; i >= 0; i--) {
+            REQUIRE(lab.cut_index() == i);
+            REQUIRE((lab.labelisation_leaves() == hch.horizontal_cut_from_index(i).labelisation_leaves(tree)));
+            REQUIRE(lab.previous_cut() == (i > 0));
+        }
+
+        auto lab2 = hch.incremental_labelisation(2);
+        REQUIRE((lab2.labelisation_leaves() == hch.horizontal_cut_from_index(2).labelisation_leaves(tree)));
+        lab2.set_cut(1);
+        REQUIRE((lab2.labelisation_leaves() == hch.horizontal_cut_from_index(1).labelisation_leaves(tree)));
+        lab2.set_cut(3);
+        REQUIRE((lab2.labelisation_leaves() == hch.horizontal_cut_from_index(3).labelisation_leaves(tree)));
+    }
+
+    TEST_CASE("horizontal cut incremental labelisation on sorted tree", "[horizontal_cuts]") {
+
+        hg::tree tree{
+                array_1d<index_t>{5, 5, 5, 6, 6, 7, 7, 7}
+        };
+        array_1d<int> altitudes{0, 0, 0, 0, 0, 1, 2, 3};
+        auto hch = make_horizontal_cut_explorer(tree, altitudes);
+
+        std::vector<array_1d<index_t>> ref_labels{
+                {7, 7, 7, 7, 7},
+                {5, 5, 5, 6, 6},
+                {5, 5, 5, 3, 4},
+                {0, 1, 2, 3, 4}
+        };
+
+        auto lab = hch.incremental_labelisation();
+        for (index_t i = 0; i < (index_t) hch.num_cuts(); i++) {
+            REQUIRE((lab.labelisation_leaves() == ref_labels[i]));
+            lab.next_cut();
+        }
+        for (index_t i = (index_t) hch.num_cuts() - 1; i >= 0; i--) {
+            REQUIRE((lab.labelisation_leaves() == ref_labels[i]));
+            lab.previous_cut();
+        }
+    }
+
+    TEST_CASE("horizontal cuts labelisations", "[horizontal_cuts]") {
+
+        hg::tree tree{
+                array_1d<index_t>{11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18}
+        };
+        array_1d<int> altitudes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3};
+        auto hch = make_horizontal_cut_explorer(tree, altitudes);
+
+        array_1d<index_t> cut_indices{2, 0, 3, 1};
+        auto res = hch.labelisations_from_indices(cut_indices);
+        REQUIRE(res.num_cuts() == 4);
+        REQUIRE((res.cut_indices == cut_indices));
+        REQUIRE(res.label_maps.shape()[0] == 4);
+        REQUIRE(res.label_maps.shape()[1] == 9);
+        for (index_t i = 0; i < (index_t) cut_indices.size(); i++) {
+            REQUIRE((res.labelisation_leaves(i) ==
+                     hch.horizontal_cut_from_index(cut_indices(i)).labelisation_leaves(tree)));
+        }
+
+        array_1d<index_t> cut_indices2{1, 2};
+        auto res2 = hch.labelisations_from_indices(cut_indices2);
+        REQUIRE(res2.label_maps.shape()[1] == 4);
+        for (index_t i = 0; i < (index_t) cut_indices2.size(); i++) {
+            REQUIRE((res2.labelisation_leaves(i) ==
+                     hch.horizontal_cut_from_index(cut_indices2(i)).labelisation_leaves(tree)));
+        }
+    }
 }
 
@@ -10,8 +10,10 @@
 
 #include "../test_utils.hpp"
 #include <cmath>
+#include <numeric>
 #include <sstream>
 #include "higra/algo/tree_energy_optimization.hpp"
+#include "higra/attribute/tree_attribute.hpp"
 #include "higra/graph.hpp"
 #include "higra/image/graph_image.hpp"
 
@@ -206,6 +208,112 @@ namespace test_linear_energy_function_optimization {
         REQUIRE(xt::allclose(altitudes, ref_altitudes));
     }
 
+    TEST_CASE("test piecewise_linear_energy_function_pool", "[linear_energy_function_optimization]") {
+        using pool_t = piecewise_linear_energy_function_pool<double>;
+
+        auto equal = [](const pool_t &pool, index_t slot, const lef_t &f) {
+            auto v = pool.view(slot);
+            if (v.size != (index_t) f.size()) {
+                return false;
+            }
+            for (index_t i = 0; i < v.size; i++) {
+                if (lep_t(v.origin_x[i], v.origin_y[i], v.slope[i]) != f[i]) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::srand(1);
+        pool_t pool(12);
+        for (int trial = 0; trial < 100; trial++) {
+            std::vector<lef_t> functions;
+            std::vector<index_t> slots;
+            for (int i = 0; i < 4; i++) {
+                double d = std::rand() % 10 + 1;
+                double r = std::rand() % 5 + 1;
+                functions.emplace_back(lep_t(0, d, r));
+                slots.push_back(pool.allocate());
+                pool.set_piece(slots.back(), 0, d, r);
+            }
+            for (int i = 0; i < 3; i++) {
+                auto f = functions[i].sum(functions[i + 1], 3);
+                pool.sum(slots[i], pool.view(slots[i]), pool.view(slots[i + 1]), 3);
+                REQUIRE(equal(pool, slots[i], f));
+                functions[i] = f;
+
+                double d = std::rand() % 30 + 1;
+                double r = std::rand() % 3 + 1;
+                auto xi = functions[i].infimum(lep_t(0, d, r));
+                auto pxi = pool.infimum(slots[i], d, r);
+                REQUIRE(xi == pxi);
+                REQUIRE(equal(pool, slots[i], functions[i]));
+                functions[i + 1] = functions[i];
+                pool.assign(slots[i + 1], pool.view(slots[i]));
+            }
+            for (auto s: slots) {
+                pool.release(s);
+            }
+        }
+    }
+
+    TEST_CASE("test hierarchy_to_optimal_energy_cut_hierarchy large tree", "[optimal_cut_tree]") {
+        // random tree with more than 4096 nodes to exercise the sub-tree decomposition
+        index_t num_leaves = 10000;
+        std::srand(42);
+        std::vector<index_t> roots(num_leaves);
+        std::iota(roots.begin(), roots.end(), 0);
+        array_1d<index_t> parents = xt::zeros<index_t>({2 * num_leaves});
+        index_t next = num_leaves;
+        while (roots.size() > 1) {
+            index_t k = (std::min)((index_t) roots.size(), (index_t) (std::rand() % 3 + 2));
+            for (index_t j = 0; j < k; j++) {
+                auto pos = std::rand() % roots.size();
+                parents(roots[pos]) = next;
+                roots[pos] = roots.back();
+                roots.pop_back();
+            }
+            roots.push_back(next++);
+        }
+        parents(next - 1) = next - 1;
+        tree t(xt::view(parents, xt::range(0, next)));
+
+        array_1d<double> area = attribute_area(t);
+        array_1d<double> data_fidelity_attribute = xt::zeros<double>({num_vertices(t)});
+        array_1d<double> regularization_attribute = xt::zeros<double>({num_vertices(t)});
+        for (auto i: leaves_to_root_iterator(t)) {
+            data_fidelity_attribute(i) = (std::rand() % 100) * area(i) / 10.0;
+            regularization_attribute(i) = std::sqrt(area(i)) * 4;
+        }
+
+        // reference computation with piecewise_linear_energy_function
+        t.compute_children();
+        std::vector<lef_t> optimal_energies(num_vertices(t));
+        array_1d<double> apparition_scales = array_1d<double>::from_shape({num_vertices(t)});
+        for (auto i: leaves_to_root_iterator(t)) {
+            if (is_leaf(i, t)) {
+                optimal_energies[i] = lef_t(lep_t(0, data_fidelity_attribute(i), regularization_attribute(i)));
+                apparition_scales(i) = -data_fidelity_attribute(i) / regularization_attribute(i);
+            } else {
+                optimal_energies[i] = optimal_energies[child(0, i, t)];
+                for (index_t c = 1; c < (index_t) num_children(i, t); c++) {
+                    optimal_energies[i] = optimal_energies[i].sum(optimal_energies[child(c, i, t)], 10);
+                }
+                apparition_scales(i) = optimal_energies[i].infimum(
+                        lep_t(0, data_fidelity_attribute(i), regularization_attribute(i)));
+            }
+        }
+        for (auto i: root_to_leaves_iterator(t, leaves_it::include, root_it::exclude)) {
+            apparition_scales(i) = (std::max)(0.0, (std::min)(apparition_scales(i), apparition_scales(parent(i, t))));
+        }
+        auto ref = simplify_tree(t, xt::equal(apparition_scales, propagate_parallel(t, apparition_scales)));
+        array_1d<double> ref_altitudes = xt::index_view(apparition_scales, ref.node_map);
+
+        auto res = hierarchy_to_optimal_energy_cut_hierarchy(t, data_fidelity_attribute, regularization_attribute);
+        REQUIRE(res.tree.parents() == ref.tree.parents());
+        REQUIRE((res.altitudes == ref_altitudes));
+    }
+
     TEST_CASE("test binary_partition_tree_MumfordShah_energy scalar", "[optimal_cut_tree]") {
         auto g = hg::get_4_adjacency_graph({3, 3});
         array_1d<double> edge_length = xt::ones<double>({num_edges(g)});
@@ -261,4 +369,32 @@ namespace test_linear_energy_function_optimization {
         REQUIRE(tree.parents() == ref_parents);
         REQUIRE(xt::allclose(altitudes, ref_altitudes));
     }
-}
\ No newline at end of file
+
+    TEST_CASE("test binary_partition_tree_MumfordShah_energy fixed and dynamic number of channels", "[optimal_cut_tree]") {
+        auto g = hg::get_4_adjacency_graph({4, 5});
+        array_1d<double> edge_length = xt::ones<double>({num_edges(g)});
+        array_1d<double> vertex_perimeter({20}, 4);
+        array_1d<double> vertex_area = xt::ones<double>({num_vertices(g)});
+        array_2d<double> vertex_values = xt::zeros<double>({20, 5});
+        std::srand(3);
+        for (index_t i = 0; i < 20; i++) {
+            for (index_t c = 0; c < 3; c++) {
+                vertex_values(i, c) = std::rand() % 20;
+            }
+        }
+        array_2d<double> squared_vertex_values = vertex_values * vertex_values;
+
+        // 3 channels: fixed size region model
+        array_2d<double> vertex_values3 = xt::view(vertex_values, xt::all(), xt::range(0, 3));
+        array_2d<double> squared_vertex_values3 = vertex_values3 * vertex_values3;
+        auto res3 = binary_partition_tree_MumfordShah_energy(
+                g, vertex_perimeter, vertex_area, vertex_values3, squared_vertex_values3, edge_length);
+
+        // 5 channels with 2 null channels: dynamic region model
+        auto res5 = binary_partition_tree_MumfordShah_energy(
+                g, vertex_perimeter, vertex_area, vertex_values, squared_vertex_values, edge_length);
+
+        REQUIRE(res3.tree.parents() == res5.tree.parents());
+        REQUIRE((res3.altitudes == res5.altitudes));
+    }
+}
@@ -10,6 +10,7 @@
 
 #include "../test_utils.hpp"
 #include "higra/algo/tree_monotonic_regression.hpp"
+#include <numeric>
 
 
 using namespace hg;
@@ -72,4 +73,52 @@ namespace test_tree_monotonic_regression {
         auto res = tree_monotonic_regression(tree, altitudes, weights, "least_square");
         REQUIRE(xt::allclose(res, ref));
     }
-}
\ No newline at end of file
+
+    TEST_CASE("tree_monotonic_regression random tree", "[tree_monotonic_regression]") {
+        std::srand(7);
+        index_t num_leaves = 500;
+        // random binary tree built by merging random pairs of roots
+        std::vector<index_t> roots(num_leaves);
+        std::iota(roots.begin(), roots.end(), 0);
+        array_1d<index_t> parents = array_1d<index_t>::from_shape({(size_t) (2 * num_leaves - 1)});
+        for (index_t n = num_leaves; n < 2 * num_leaves - 1; n++) {
+            for (index_t j = 0; j < 2; j++) {
+                auto pos = std::rand() % roots.size();
+                parents(roots[pos]) = n;
+                roots[pos] = roots.back();
+                roots.pop_back();
+            }
+            roots.push_back(n);
+        }
+        parents(2 * num_leaves - 2) = 2 * num_leaves - 2;
+        hg::tree tree(parents);
+        array_1d<double> altitudes = array_1d<double>::from_shape({num_vertices(tree)});
+        array_1d<double> weights = array_1d<double>::from_shape({num_vertices(tree)});
+        for (auto i: leaves_to_root_iterator(tree)) {
+            altitudes(i) = std::rand() % 100;
+            weights(i) = std::rand() % 5 + 1;
+        }
+
+        auto is_increasing = [&tree](const array_1d<double> &a) {
+            for (auto i: leaves_to_root_iterator(tree, leaves_it::include, root_it::exclude)) {
+                if (a(i) > a(parent(i, tree))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        array_1d<double> res_max = tree_monotonic_regression(tree, altitudes, "max");
+        array_1d<double> res_min = tree_monotonic_regression(tree, altitudes, "min");
+        array_1d<double> res_ls = tree_monotonic_regression(tree, altitudes, weights, "least_square");
+        REQUIRE(is_increasing(res_max));
+        REQUIRE(is_increasing(res_min));
+        REQUIRE(is_increasing(res_ls));
+        REQUIRE(xt::all(res_max >= altitudes));
+        REQUIRE(xt::all(res_min <= altitudes));
+        REQUIRE(xt::all(res_ls >= res_min - 1e-9));
+        REQUIRE(xt::all(res_ls <= res_max + 1e-9));
+        // each block of the least square solution preserves the weighted sum of its values
+        REQUIRE(std::abs(xt::sum(weights * res_ls)() - xt::sum(weights * altitudes)()) < 1e-6);
+    }
+}
@@ -12,6 +12,7 @@
 #include "higra/assessment/partition.hpp"
 #include "higra/image/graph_image.hpp"
 #include "../test_utils.hpp"
+#include <set>
 
 using namespace hg;
 
@@ -238,4 +239,105 @@ namespace assessment_fragmentation_curve {
             REQUIRE(xt::allclose(res_scores, ref_scores / 11));
             REQUIRE(res_k == ref_k);
     }
+
+    TEST_CASE("fragmentation curve optimal cut multiple ground truths", "[fragmentation_curve]") {
+        tree t(array_1d<index_t>{8, 8, 9, 9, 10, 10, 11, 13, 12, 12, 11, 13, 14, 14, 14});
+        array_2d<char> ground_truths{{0, 0, 1, 1, 1, 2, 2, 2},
+                                     {0, 0, 0, 0, 1, 1, 1, 1},
+                                     {0, 1, 1, 2, 2, 2, 3, 3}};
+
+        assesser_fragmentation_optimal_cut_multiple_ground_truths assesser(t, ground_truths,
+                                                                           optimal_cut_measure::BCE);
+        REQUIRE(assesser.num_ground_truths() == 3);
+
+        array_1d<double> mean_scores = xt::zeros<double>({8});
+        for (index_t i = 0; i < 3; i++) {
+            assesser_fragmentation_optimal_cut ref(t, xt::eval(xt::view(ground_truths, i, xt::all())),
+                                                   optimal_cut_measure::BCE);
+            auto ref_curve = ref.fragmentation_curve();
+            auto res_curve = assesser.fragmentation_curve(i);
+            REQUIRE(xt::allclose(res_curve.scores(), ref_curve.scores()));
+            REQUIRE(res_curve.num_regions() == ref_curve.num_regions());
+            REQUIRE(res_curve.num_regions_ground_truth() == ref_curve.num_regions_ground_truth());
+            REQUIRE(assesser.optimal_number_of_regions(i) == ref.optimal_number_of_regions());
+            REQUIRE(almost_equal(assesser.optimal_score(i), ref.optimal_score()));
+            REQUIRE(is_in_bijection(assesser.optimal_partition(i), ref.optimal_partition()));
+            REQUIRE(is_in_bijection(assesser.optimal_partition(i, 2), ref.optimal_partition(2)));
+            mean_scores += ref_curve.scores();
+        }
+        mean_scores /= 3;
+
+        auto curves = assesser.fragmentation_curves();
+        REQUIRE(curves.size() == 3);
+
+        auto aggregated = assesser.aggregated_fragmentation_curve();
+        auto &aggregated_scores = aggregated.scores();
+        REQUIRE(aggregated.num_regions_ground_truth() == 3);
+        REQUIRE(aggregated_scores.size() == 8);
+        // single region and all leaves partitions are unique
+        REQUIRE(almost_equal(aggregated_scores(0), mean_scores(0)));
+        REQUIRE(almost_equal(aggregated_scores(7), mean_scores(7)));
+        REQUIRE(xt::all(aggregated_scores <= mean_scores + 1e-12));
+        REQUIRE(almost_equal(assesser.aggregated_optimal_score(), xt::amax(aggregated_scores)()));
+        REQUIRE(aggregated.optimal_number_of_regions() == assesser.aggregated_optimal_number_of_regions());
+        auto partition = assesser.aggregated_optimal_partition(4);
+        REQUIRE(std::set<index_t>(partition.begin(), partition.end()).size() == 4);
+    }
+
+    TEST_CASE("fragmentation curve optimal cut multiple ground truths identical", "[fragmentation_curve]") {
+        tree t(array_1d<index_t>{8, 8, 9, 9, 10, 10, 11, 13, 12, 12, 11, 13, 14, 14, 14});
+        array_2d<char> ground_truths{{0, 0, 1, 1, 1, 2, 2, 2},
+                                     {1, 1, 2, 2, 2, 5, 5, 5}};
+
+        assesser_fragmentation_optimal_cut_multiple_ground_truths assesser(t, ground_truths,
+                                                                           optimal_cut_measure::BCE);
+
+        auto res = assesser.aggregated_fragmentation_curve();
+        array_1d<double> ref_scores{
+                2.75, 4.5, 2 + 4.0 / 3 + 2.5, 2 + 4.0 / 3 + 2, 2 + 4.0 / 3 + 4.0 / 3,
+                2 + 4.0 / 3 + 4.0 / 3, 4, 3
+        };
+        REQUIRE(res.num_regions_ground_truth() == 3);
+        REQUIRE(xt::allclose(res.scores(), ref_scores / num_leaves(t)));
+        REQUIRE(assesser.aggregated_optimal_number_of_regions() == 3);
+        REQUIRE(is_in_bijection(assesser.aggregated_optimal_partition(),
+                                array_1d<index_t>{0, 0, 1, 1, 2, 2, 2, 2}));
+    }
+
+    TEST_CASE("fragmentation curve DHaming horizontal cut multiple ground truths", "[fragmentation_curve]") {
+        hg::tree tree{
+                array_1d<index_t>{11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18}
+        };
+        array_1d<int> altitudes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3};
+        array_2d<int> ground_truths{{3, 3, 3, 3, 1, 1, 1, 2, 2, 2, 2},
+                                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                                    {0, 0, 0, 1, 1, 1, 2, 2, 3, 3, 4}};
+
+        auto res = assess_fragmentation_horizontal_cut_multiple_ground_truths(tree,
+                                                                              altitudes,
+                                                                              ground_truths,
+                                                                              scorer_partition_DHamming());
+        auto &curves = res.first;
+        auto &aggregated = res.second;
+        REQUIRE(curves.size() == 3);
+
+        array_1d<double> mean_scores = xt::zeros<double>({4});
+        double mean_num_regions = 0;
+        for (index_t i = 0; i < 3; i++) {
+            auto ref = assess_fragmentation_horizontal_cut(tree,
+                                                           altitudes,
+                                                           xt::eval(xt::view(ground_truths, i, xt::all())),
+                                                           scorer_partition_DHamming());
+            REQUIRE(xt::allclose(curves[i].scores(), ref.scores()));
+            REQUIRE(curves[i].num_regions() == ref.num_regions());
+            REQUIRE(curves[i].num_regions_ground_truth() == ref.num_regions_ground_truth());
+            mean_scores += ref.scores();
+            mean_num_regions += ref.num_regions_ground_truth();
+        }
+
+        array_1d<double> ref_k{1, 3, 4, 9};
+        REQUIRE(aggregated.num_regions() == ref_k);
+        REQUIRE(xt::allclose(aggregated.scores(), mean_scores / 3));
+        REQUIRE(aggregated.num_regions_ground_truth() == 3);
+    }
 }
\ No newline at end of file
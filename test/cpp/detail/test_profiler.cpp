@@ -0,0 +1,70 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2021)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include "../test_utils.hpp"
+#include "higra/detail/profiler.hpp"
+#include <string>
+#include <vector>
+
+namespace test_profiler {
+
+    using namespace hg;
+    using namespace std;
+
+    static const char *outer_name = "test_profiler_outer";
+    static const char *inner_name = "test_profiler_inner";
+
+    void profiled_function() {
+        scoped_timer timer(outer_name);
+        for (int i = 0; i < 2; i++) {
+            scoped_timer timer_inner(inner_name);
+            profiler::record_allocation(8);
+        }
+    }
+
+    TEST_CASE("test profiler disabled", "[profiler]") {
+        profiler::enabled() = false;
+        profiler::reset();
+        profiled_function();
+        auto counters = profiler::snapshot();
+        REQUIRE(counters[outer_name].calls == 0);
+    }
+
+    TEST_CASE("test profiler counters", "[profiler]") {
+        profiler::enabled() = true;
+        profiler::events_enabled() = true;
+        profiler::reset();
+        profiled_function();
+        profiled_function();
+        profiler::enabled() = false;
+        profiler::events_enabled() = false;
+
+        auto counters = profiler::snapshot();
+        auto &outer = counters[outer_name];
+        auto &inner = counters[inner_name];
+        REQUIRE(outer.calls == 2);
+        REQUIRE(inner.calls == 4);
+        REQUIRE(outer.allocated_bytes == 0);
+        REQUIRE(inner.allocated_bytes == 32);
+        REQUIRE(outer.time >= inner.time);
+
+        auto events = profiler::events();
+        REQUIRE(events.size() == 6);
+
+        auto json = profiler::chrome_trace_json();
+        REQUIRE(json.find("\"traceEvents\"") != string::npos);
+        REQUIRE(json.find(inner_name) != string::npos);
+
+        profiler::reset();
+        counters = profiler::snapshot();
+        REQUIRE(counters[outer_name].calls == 0);
+        REQUIRE(profiler::events().empty());
+    }
+}
@@ -0,0 +1,147 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2021)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include "higra/graph.hpp"
+#include "higra/image/graph_image.hpp"
+#include "higra/hierarchy/hierarchy_core.hpp"
+#include "xtensor/generators/xrandom.hpp"
+#include "../test_utils.hpp"
+
+namespace test_csr_graph {
+
+    using namespace std;
+    using namespace hg;
+
+    // 0 - 1
+    // | /
+    // 2   3
+    auto get_graph() {
+        return csr_graph(4, array_1d<index_t>{0, 1, 2}, array_1d<index_t>{1, 2, 0});
+    }
+
+    TEST_CASE("csr graph size", "[csr_graph]") {
+        auto g = get_graph();
+        REQUIRE(num_vertices(g) == 4);
+        REQUIRE(num_edges(g) == 3);
+        REQUIRE(out_degree(0, g) == 2);
+        REQUIRE(in_degree(0, g) == 2);
+        REQUIRE(degree(0, g) == 2);
+        REQUIRE(degree(3, g) == 0);
+
+        array_1d<index_t> indices{0, 3, 1};
+        array_1d<size_t> ref{2, 0, 2};
+        REQUIRE((degree(indices, g) == ref));
+
+        csr_graph g0;
+        REQUIRE(num_vertices(g0) == 0);
+        REQUIRE(num_edges(g0) == 0);
+
+        csr_graph g1(3);
+        REQUIRE(num_vertices(g1) == 3);
+        REQUIRE(num_edges(g1) == 0);
+        REQUIRE(degree(1, g1) == 0);
+    }
+
+    TEST_CASE("csr graph iterators", "[csr_graph]") {
+        auto g = get_graph();
+
+        vector<index_t> vtest;
+        for (auto v: vertex_iterator(g)) {
+            vtest.push_back(v);
+        }
+        REQUIRE(vectorEqual(vector<index_t>{0, 1, 2, 3}, vtest));
+
+        vector<pair<index_t, index_t>> eref{{0, 1},
+                                            {1, 2},
+                                            {2, 0}};
+        vector<pair<index_t, index_t>> etest;
+        for (auto e: edge_iterator(g)) {
+            etest.push_back({source(e, g), target(e, g)});
+            REQUIRE(e == edge_from_index(index(e, g), g));
+        }
+        REQUIRE(vectorEqual(eref, etest));
+
+        vector<vector<pair<index_t, index_t>>> outListsRef{
+                {{0, 1}, {0, 2}},
+                {{1, 0}, {1, 2}},
+                {{2, 1}, {2, 0}},
+                {}
+        };
+        vector<vector<index_t>> outIndicesRef{{0, 2},
+                                              {0, 1},
+                                              {1, 2},
+                                              {}};
+        for (auto v: vertex_iterator(g)) {
+            vector<pair<index_t, index_t>> outListTest;
+            vector<pair<index_t, index_t>> inListTest;
+            vector<index_t> outIndicesTest;
+            vector<index_t> adjacentTest;
+            for (auto e: out_edge_iterator(v, g)) {
+                outListTest.push_back({source(e, g), target(e, g)});
+                outIndicesTest.push_back(index(e, g));
+            }
+            for (auto e: in_edge_iterator(v, g)) {
+                inListTest.push_back({target(e, g), source(e, g)});
+            }
+            for (auto a: adjacent_vertex_iterator(v, g)) {
+                adjacentTest.push_back(a);
+            }
+            REQUIRE(vectorEqual(outListsRef[v], outListTest));
+            REQUIRE(vectorEqual(outListsRef[v], inListTest));
+            REQUIRE(vectorEqual(outIndicesRef[v], outIndicesTest));
+            REQUIRE(adjacentTest.size() == outListsRef[v].size());
+            for (index_t i = 0; i < (index_t) adjacentTest.size(); i++) {
+                REQUIRE(adjacentTest[i] == outListsRef[v][i].second);
+            }
+        }
+    }
+
+    TEST_CASE("csr graph self loop", "[csr_graph]") {
+        csr_graph g(2, array_1d<index_t>{0, 1}, array_1d<index_t>{0, 0});
+        REQUIRE(degree(0, g) == 2);
+        REQUIRE(degree(1, g) == 1);
+        REQUIRE((g.out_edge_offsets() == array_1d<index_t>{0, 2, 3}));
+        REQUIRE((g.out_edge_indices() == array_1d<index_t>{0, 1, 1}));
+    }
+
+    TEST_CASE("csr graph borrowed buffers", "[csr_graph]") {
+        auto buffer = std::make_shared<std::vector<index_t>>(std::vector<index_t>{0, 1, 2, 1, 2, 0});
+        std::weak_ptr<std::vector<index_t>> observer = buffer;
+        auto data = buffer->data();
+        auto src = make_shared_array_1d(data, 3, buffer);
+        auto tgt = make_shared_array_1d(data + 3, 3, std::move(buffer));
+
+        auto g = std::make_unique<csr_graph>(4, std::move(src), std::move(tgt));
+        REQUIRE(g->sources().data() == data);
+        REQUIRE(g->targets().data() == data + 3);
+        REQUIRE((sources(*g) == array_1d<index_t>{0, 1, 2}));
+        REQUIRE((targets(*g) == array_1d<index_t>{1, 2, 0}));
+
+        auto g2 = std::make_unique<csr_graph>(*g);
+        g.reset();
+        REQUIRE(!observer.expired());
+        REQUIRE(g2->sources().data() == data);
+        REQUIRE(degree(0, *g2) == 2);
+        g2.reset();
+        REQUIRE(observer.expired());
+    }
+
+    TEST_CASE("csr graph bpt_canonical", "[csr_graph]") {
+        auto g = get_4_adjacency_graph({4, 5});
+        array_1d<double> weights = xt::eval(xt::random::randint<int>({num_edges(g)}, 0, 5));
+
+        csr_graph g2(num_vertices(g), sources(g), targets(g));
+        auto res = bpt_canonical(g, weights);
+        auto res2 = bpt_canonical(g2, weights);
+        REQUIRE((res.tree.parents() == res2.tree.parents()));
+        REQUIRE((res.altitudes == res2.altitudes));
+        REQUIRE((res.mst_edge_map == res2.mst_edge_map));
+    }
+}
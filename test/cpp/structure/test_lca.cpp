@@ -123,4 +123,40 @@ namespace lca {
         auto l2 = lca3.lca(v1, v2);
         REQUIRE((l2 == ref));
     }
+
+    TEMPLATE_TEST_CASE("lca copies share their arrays", "[lca]", hg::lca_sparse_table, hg::lca_sparse_table_block) {
+        tree t(array_1d<index_t>{4, 4, 5, 5, 6, 6, 6});
+        array_1d<index_t> v1{0, 0, 1, 3};
+        array_1d<index_t> v2{0, 3, 0, 0};
+        array_1d<index_t> ref{0, 6, 4, 6};
+
+        auto lca = std::make_unique<TestType>(t);
+        TestType lca2(*lca);
+        REQUIRE(lca2.get_state().tree_Euler_tour_depth.data() == lca->get_state().tree_Euler_tour_depth.data());
+        lca.reset();
+        REQUIRE((lca2.lca(v1, v2) == ref));
+    }
+
+    TEMPLATE_TEST_CASE("lca from borrowed state", "[lca]", hg::lca_sparse_table, hg::lca_sparse_table_block) {
+        tree t(array_1d<index_t>{4, 4, 5, 5, 6, 6, 6});
+        array_1d<index_t> v1{0, 0, 1, 3};
+        array_1d<index_t> v2{0, 3, 0, 0};
+        array_1d<index_t> ref{0, 6, 4, 6};
+
+        // external buffer holding a copy of the Euler tour depth
+        auto state = TestType(t).get_state();
+        auto &depth = state.tree_Euler_tour_depth;
+        auto buffer = std::make_shared<std::vector<index_t>>(depth.begin(), depth.end());
+        std::weak_ptr<std::vector<index_t>> observer = buffer;
+        auto data = buffer->data();
+        auto size = buffer->size();
+        state.tree_Euler_tour_depth = make_shared_array_1d(data, size, std::move(buffer));
+
+        auto lca = std::make_unique<TestType>(TestType::make_from_state(std::move(state)));
+        REQUIRE(lca->get_state().tree_Euler_tour_depth.data() == data);
+        REQUIRE((lca->lca(v1, v2) == ref));
+        REQUIRE(!observer.expired());
+        lca.reset();
+        REQUIRE(observer.expired());
+    }
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+/***************************************************************************
+* Copyright ESIEE Paris (2020)                                             *
+*                                                                          *
+* Contributor(s) : Benjamin Perret                                         *
+*                                                                          *
+* Distributed under the terms of the CECILL-B License.                     *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include "higra/structure/leftist_heap.hpp"
+#include "../test_utils.hpp"
+#include <random>
+#include <algorithm>
+
+namespace test_leftist_heap {
+
+    using namespace hg;
+    using namespace std;
+
+    TEST_CASE("leftist heap push pop", "[leftist_heap]") {
+        leftist_heap_forest<int> heaps(6);
+        index_t h = invalid_index;
+        REQUIRE(heaps.empty(h));
+        vector<int> keys{5, 2, 8, 1, 9, 2};
+        for (index_t i = 0; i < (index_t) keys.size(); i++) {
+            h = heaps.push(h, i, keys[i]);
+        }
+        vector<int> res;
+        while (!heaps.empty(h)) {
+            res.push_back(heaps.key(heaps.top(h)));
+            h = heaps.pop(h);
+        }
+        REQUIRE(res == vector<int>{1, 2, 2, 5, 8, 9});
+    }
+
+    TEST_CASE("leftist heap max heap", "[leftist_heap]") {
+        leftist_heap_forest<double, std::greater<double>> heaps(3);
+        index_t h = heaps.make_heap(0, 1.5);
+        h = heaps.push(h, 1, 3.5);
+        h = heaps.push(h, 2, 2.5);
+        REQUIRE(heaps.top(h) == 1);
+        h = heaps.pop(h);
+        REQUIRE(heaps.top(h) == 2);
+        h = heaps.pop(h);
+        REQUIRE(heaps.top(h) == 0);
+        h = heaps.pop(h);
+        REQUIRE(heaps.empty(h));
+    }
+
+    TEST_CASE("leftist heap merge random", "[leftist_heap]") {
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> dis(0, 1000);
+        index_t num_elements = 2000;
+        index_t num_heaps = 20;
+        leftist_heap_forest<int> heaps(num_elements);
+        vector<index_t> roots(num_heaps, invalid_index);
+        vector<vector<int>> refs(num_heaps);
+        for (index_t i = 0; i < num_elements; i++) {
+            auto h = i % num_heaps;
+            auto k = dis(gen);
+            roots[h] = heaps.push(roots[h], i, k);
+            refs[h].push_back(k);
+        }
+        for (index_t h = 1; h < num_heaps; h++) {
+            roots[0] = heaps.merge(roots[0], roots[h]);
+            refs[0].insert(refs[0].end(), refs[h].begin(), refs[h].end());
+        }
+        sort(refs[0].begin(), refs[0].end());
+        vector<int> res;
+        while (!heaps.empty(roots[0])) {
+            res.push_back(heaps.key(heaps.top(roots[0])));
+            roots[0] = heaps.pop(roots[0]);
+        }
+        REQUIRE(res == refs[0]);
+    }
+}
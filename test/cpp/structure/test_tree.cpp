@@ -118,6 +118,66 @@ namespace tree {
         REQUIRE_THROWS_AS(hg::tree(xt::xarray<index_t>{2, 2, 4, 4, 4}), std::runtime_error);
     }
 
+    TEST_CASE("tree ctr borrowed buffer", "[tree]") {
+        auto buffer = std::make_shared<std::vector<index_t>>(std::vector<index_t>{5, 5, 6, 6, 6, 7, 7, 7});
+        std::weak_ptr<std::vector<index_t>> observer = buffer;
+        auto data = buffer->data();
+
+        auto t = std::make_unique<hg::tree>(data, buffer->size(), std::move(buffer));
+        REQUIRE(num_vertices(*t) == 8);
+        REQUIRE(num_leaves(*t) == 5);
+        REQUIRE(t->parents().data() == data);
+        REQUIRE(!observer.expired());
+
+        // copies share the buffer
+        auto t2 = std::make_unique<hg::tree>(*t);
+        REQUIRE(t2->parents().data() == data);
+        t.reset();
+        REQUIRE(!observer.expired());
+        REQUIRE((t2->parents() == array_1d<index_t>{5, 5, 6, 6, 6, 7, 7, 7}));
+        REQUIRE(root(*t2) == 7);
+
+        // the owner is released with the last copy
+        t2.reset();
+        REQUIRE(observer.expired());
+    }
+
+    TEST_CASE("tree ctr shared array", "[tree]") {
+        auto parents = to_shared_array_1d(array_1d<index_t>{5, 5, 6, 6, 6, 7, 7, 7});
+        auto data = parents.data();
+        hg::tree t(parents);
+        REQUIRE(t.parents().data() == data);
+        REQUIRE(num_leaves(t) == 5);
+
+        hg::tree t2(t);
+        REQUIRE(t2.parents().data() == data);
+        hg::tree t3;
+        t3 = t;
+        REQUIRE(t3.parents().data() == data);
+        REQUIRE(num_leaves(t3) == 5);
+    }
+
+    TEST_CASE("tree ctr without check", "[tree]") {
+        auto parents = to_shared_array_1d(array_1d<index_t>{5, 5, 6, 6, 6, 7, 7, 7});
+        hg::tree t(parents, tree_category::partition_tree, false);
+        REQUIRE(num_vertices(t) == 8);
+        REQUIRE(num_leaves(t) == 5);
+        REQUIRE(root(t) == 7);
+        t.compute_children();
+        REQUIRE(t.num_children(5) == 2);
+        REQUIRE(t.num_children(6) == 3);
+        REQUIRE(t.num_children(7) == 2);
+
+        hg::tree t1(to_shared_array_1d(array_1d<index_t>{0}), tree_category::partition_tree, false);
+        REQUIRE(num_leaves(t1) == 1);
+
+        // invalid trees are not detected
+        REQUIRE_NOTHROW(hg::tree(to_shared_array_1d(array_1d<index_t>{5, 0, 6, 6, 6, 7, 7, 7}),
+                                 tree_category::partition_tree, false));
+        REQUIRE_THROWS_AS(hg::tree(to_shared_array_1d(array_1d<index_t>{5, 0, 6, 6, 6, 7, 7, 7})),
+                          std::runtime_error);
+    }
+
     TEST_CASE("tree edge iterator", "[tree]") {
         auto g = data.t;
 
@@ -159,6 +159,50 @@ class TestHorizontalCuts(unittest.TestCase):
         ref_vweights = np.array(((1, 1), (1, 0)))
         self.assertTrue(np.all(vweights == ref_vweights))
 
+    def test_horizontal_cut_incremental_labelisation(self):
+        g = hg.get_4_adjacency_graph((1, 11))
+        tree = hg.Tree((11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18))
+        hg.CptHierarchy.link(tree, g)
+        altitudes = np.asarray((0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3))
+
+        hch = hg.HorizontalCutExplorer(tree, altitudes)
+
+        lab = hch.incremental_labelisation()
+        for i in range(hch.num_cuts()):
+            self.assertTrue(lab.cut_index() == i)
+            self.assertTrue(lab.num_regions() == hch.num_regions_cut(i))
+            ref = hch.horizontal_cut_from_index(i).labelisation_leaves(tree).ravel()
+            self.assertTrue(np.all(lab.labelisation_leaves() == ref))
+            self.assertTrue(lab.next_cut() == (i + 1 < hch.num_cuts()))
+
+        for i in range(hch.num_cuts() - 1, -1, -1):
+            ref = hch.horizontal_cut_from_index(i).labelisation_leaves(tree).ravel()
+            self.assertTrue(np.all(lab.labelisation_leaves() == ref))
+            self.assertTrue(lab.previous_cut() == (i > 0))
+
+        lab.set_cut(2)
+        ref = hch.horizontal_cut_from_index(2).labelisation_leaves(tree).ravel()
+        self.assertTrue(np.all(lab.labelisation_leaves() == ref))
+
+    def test_horizontal_cuts_labelisations(self):
+        g = hg.get_4_adjacency_graph((1, 11))
+        tree = hg.Tree((11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18))
+        hg.CptHierarchy.link(tree, g)
+        altitudes = np.asarray((0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3))
+
+        hch = hg.HorizontalCutExplorer(tree, altitudes)
+
+        cut_indices = np.asarray((2, 0, 1), dtype=np.int64)
+        res = hch.labelisations_from_indices(cut_indices)
+        self.assertTrue(res.num_cuts() == 3)
+        self.assertTrue(np.all(res.cut_indices() == cut_indices))
+        self.assertTrue(res.label_maps().shape == (3, 4))
+
+        for i in range(3):
+            ref = hch.horizontal_cut_from_index(cut_indices[i]).labelisation_leaves(tree)
+            self.assertTrue(np.all(res.labelisation_leaves(i, tree) == ref))
+            self.assertTrue(np.all(res.label_maps()[i, res.leaf_labels()] == ref.ravel()))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -103,6 +103,62 @@ class TestFragmentationCurve(unittest.TestCase):
         self.assertTrue(np.allclose(res_scores, (ref_scores / tree.num_leaves())))
         self.assertTrue(np.allclose(res_k, ref_k))
 
+    def test_assess_fragmentation_curve_optimal_cut_multiple_ground_truths(self):
+        t = hg.Tree((8, 8, 9, 9, 10, 10, 11, 13, 12, 12, 11, 13, 14, 14, 14))
+        ground_truths = [np.asarray((0, 0, 1, 1, 1, 2, 2, 2), dtype=np.int32),
+                         np.asarray((0, 0, 0, 0, 1, 1, 1, 1), dtype=np.int32),
+                         np.asarray((0, 1, 1, 2, 2, 2, 3, 3), dtype=np.int32)]
+
+        assesser = hg.make_assesser_fragmentation_optimal_cut_multiple_ground_truths(t, ground_truths,
+                                                                                      hg.OptimalCutMeasure.BCE)
+        self.assertTrue(assesser.num_ground_truths() == 3)
+
+        mean_scores = np.zeros((8,))
+        for i, ground_truth in enumerate(ground_truths):
+            ref = hg.make_assesser_fragmentation_optimal_cut(t, ground_truth, hg.OptimalCutMeasure.BCE)
+            self.assertTrue(np.allclose(assesser.fragmentation_curve(i).scores(), ref.fragmentation_curve().scores()))
+            self.assertTrue(assesser.optimal_number_of_regions(i) == ref.optimal_number_of_regions())
+            self.assertTrue(np.isclose(assesser.optimal_score(i), ref.optimal_score()))
+            self.assertTrue(hg.is_in_bijection(assesser.optimal_partition(i), ref.optimal_partition()))
+            mean_scores += ref.fragmentation_curve().scores()
+        mean_scores /= 3
+
+        curves, aggregated = hg.assess_fragmentation_optimal_cut_multiple_ground_truths(t, ground_truths,
+                                                                                        hg.OptimalCutMeasure.BCE)
+        self.assertTrue(len(curves) == 3)
+        aggregated_scores = aggregated.scores()
+        self.assertTrue(np.isclose(aggregated_scores[0], mean_scores[0]))
+        self.assertTrue(np.isclose(aggregated_scores[-1], mean_scores[-1]))
+        self.assertTrue(np.all(aggregated_scores <= mean_scores + 1e-12))
+        self.assertTrue(np.isclose(assesser.aggregated_optimal_score(), np.max(aggregated_scores)))
+
+    def test_assess_fragmentation_curve_DHamming_horizontal_cut_multiple_ground_truths(self):
+        tree = hg.Tree((11, 11, 11, 12, 12, 16, 13, 13, 13, 14, 14, 17, 16, 15, 15, 18, 17, 18, 18))
+
+        altitudes = np.asarray((0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 3, 1, 2, 3))
+        ground_truths = np.asarray(((0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2),
+                                    (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+                                    (0, 0, 0, 1, 1, 1, 2, 2, 3, 3, 4)), dtype=np.int16)
+
+        curves, aggregated = hg.assess_fragmentation_horizontal_cut_multiple_ground_truths(tree,
+                                                                                           altitudes,
+                                                                                           ground_truths,
+                                                                                           hg.PartitionMeasure.DHamming)
+        self.assertTrue(len(curves) == 3)
+        mean_scores = np.zeros((4,))
+        for i in range(3):
+            ref = hg.assess_fragmentation_horizontal_cut(tree,
+                                                         altitudes,
+                                                         ground_truths[i],
+                                                         hg.PartitionMeasure.DHamming)
+            self.assertTrue(np.allclose(curves[i].scores(), ref.scores()))
+            self.assertTrue(np.allclose(curves[i].num_regions(), ref.num_regions()))
+            mean_scores += ref.scores()
+
+        self.assertTrue(np.allclose(aggregated.scores(), mean_scores / 3))
+        self.assertTrue(np.allclose(aggregated.num_regions(), (1, 3, 4, 9)))
+        self.assertTrue(aggregated.num_regions_ground_truth() == 3)
+
 
 if __name__ == '__main__':
     unittest.main()
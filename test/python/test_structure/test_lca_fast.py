@@ -105,6 +105,27 @@ class TestLCAFast(unittest.TestCase):
                 self.assertTrue(lca.test == lca2.test)
                 self.assertTrue(hg.has_tag(lca2, "foo"))
 
+    def test_state_no_copy(self):
+        tree = hg.Tree((4, 4, 5, 5, 6, 6, 6))
+        for lca_t in [hg.LCA_rmq_sparse_table, hg.LCA_rmq_sparse_table_block]:
+            with self.subTest(lca_type=lca_t):
+                lca = lca_t(tree)
+                state = lca._get_state()
+                # the state is a view on the arrays of the object
+                self.assertTrue(np.shares_memory(state[0][0], lca._get_state()[0][0]))
+
+                state = pickle_copy(state)
+                lca2 = lca_t._make_from_state(state)
+                self.assertTrue(np.shares_memory(state[0][0], lca2._get_state()[0][0]))
+                del state
+                res = lca2.lca((0, 0, 1, 3), (0, 3, 0, 0))
+                self.assertTrue(np.all(res == (0, 6, 4, 6)))
+
+
+def pickle_copy(obj):
+    import pickle
+    return pickle.loads(pickle.dumps(obj))
+
 
 if __name__ == '__main__':
     unittest.main()
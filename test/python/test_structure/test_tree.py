@@ -84,6 +84,53 @@ class TestTree(unittest.TestCase):
         with self.assertRaises(RuntimeError):
             hg.Tree((2, 2, 4, 4, 4))
 
+    def test_ctr_no_copy(self):
+        parent_relation = np.asarray((5, 5, 6, 6, 6, 7, 7, 7), dtype=np.int64)
+        t = hg.Tree(parent_relation, copy=False)
+        self.assertTrue(np.shares_memory(t.parents(), parent_relation))
+        self.assertTrue(t.num_leaves() == 5)
+
+        # the tree keeps the array alive
+        del parent_relation
+        import gc
+        gc.collect()
+        self.assertTrue(np.all(t.parents() == (5, 5, 6, 6, 6, 7, 7, 7)))
+        self.assertTrue(np.all(t.num_children() == (2, 3, 2)))
+
+        # a copy is made if the array cannot be used directly
+        parent_relation = np.asarray((5, 5, 6, 6, 6, 7, 7, 7), dtype=np.int32)
+        t = hg.Tree(parent_relation, copy=False)
+        self.assertFalse(np.shares_memory(t.parents(), parent_relation))
+        parent_relation = np.asarray((5, 0, 5, 0, 6, 0, 6, 0, 6, 0, 7, 0, 7, 0, 7, 0), dtype=np.int64)[::2]
+        t = hg.Tree(parent_relation, copy=False)
+        self.assertFalse(np.shares_memory(t.parents(), parent_relation))
+        self.assertTrue(np.all(t.parents() == (5, 5, 6, 6, 6, 7, 7, 7)))
+
+        parent_relation = np.asarray((5, 5, 6, 6, 6, 7, 7, 7), dtype=np.int64)
+        t = hg.Tree(parent_relation)
+        self.assertFalse(np.shares_memory(t.parents(), parent_relation))
+
+    def test_ctr_no_copy_memmap(self):
+        import tempfile
+        import os
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            filename = os.path.join(tmp_dir, "parents.bin")
+            np.asarray((5, 5, 6, 6, 6, 7, 7, 7), dtype=np.int64).tofile(filename)
+            parent_relation = np.memmap(filename, dtype=np.int64, mode="r")
+            t = hg.Tree(parent_relation, copy=False)
+            self.assertTrue(np.shares_memory(t.parents(), parent_relation))
+            self.assertTrue(t.num_leaves() == 5)
+            del parent_relation
+            del t
+
+    def test_ctr_no_check(self):
+        t = hg.Tree((5, 5, 6, 6, 6, 7, 7, 7), check=False)
+        self.assertTrue(t.num_leaves() == 5)
+        self.assertTrue(np.all(t.num_children() == (2, 3, 2)))
+
+        # invalid parent relations are not detected
+        hg.Tree((5, 0, 6, 6, 6, 7, 7, 7), check=False)
+
     def test_edge_iterator(self):
         t = TestTree.get_tree()
 